@@ -25,6 +25,9 @@ namespace CesiumForUnity
         private SerializedProperty _maximumSimultaneousTileLoads;
         private SerializedProperty _maximumCachedBytes;
         private SerializedProperty _loadingDescendantLimit;
+        private SerializedProperty _mainThreadLoadingTimeLimit;
+        private SerializedProperty _tileCacheUnloadTimeLimit;
+        private SerializedProperty _prefetchLookAheadTime;
 
         private SerializedProperty _enableFrustumCulling;
         private SerializedProperty _enableFogCulling;
@@ -32,6 +35,11 @@ namespace CesiumForUnity
         private SerializedProperty _culledScreenSpaceError;
 
         private SerializedProperty _opaqueMaterial;
+        private SerializedProperty _combinePrimitives;
+        private SerializedProperty _normalFormat;
+        private SerializedProperty _texCoordFormat;
+        private SerializedProperty _quantizePositions;
+        private SerializedProperty _compressTextures;
         //private SerializedProperty _useLodTransitions;
         //private SerializedProperty _lodTransitionLength;
         // private SerializedProperty _generateSmoothNormals;
@@ -66,6 +74,12 @@ namespace CesiumForUnity
             this._maximumCachedBytes = this.serializedObject.FindProperty("_maximumCachedBytes");
             this._loadingDescendantLimit =
                 this.serializedObject.FindProperty("_loadingDescendantLimit");
+            this._mainThreadLoadingTimeLimit =
+                this.serializedObject.FindProperty("_mainThreadLoadingTimeLimit");
+            this._tileCacheUnloadTimeLimit =
+                this.serializedObject.FindProperty("_tileCacheUnloadTimeLimit");
+            this._prefetchLookAheadTime =
+                this.serializedObject.FindProperty("_prefetchLookAheadTime");
 
             this._enableFrustumCulling =
                 this.serializedObject.FindProperty("_enableFrustumCulling");
@@ -76,6 +90,11 @@ namespace CesiumForUnity
                 this.serializedObject.FindProperty("_culledScreenSpaceError");
 
             this._opaqueMaterial = this.serializedObject.FindProperty("_opaqueMaterial");
+            this._combinePrimitives = this.serializedObject.FindProperty("_combinePrimitives");
+            this._normalFormat = this.serializedObject.FindProperty("_normalFormat");
+            this._texCoordFormat = this.serializedObject.FindProperty("_texCoordFormat");
+            this._quantizePositions = this.serializedObject.FindProperty("_quantizePositions");
+            this._compressTextures = this.serializedObject.FindProperty("_compressTextures");
             //this._useLodTransitions = this.serializedObject.FindProperty("_useLodTransitions");
             //this._lodTransitionLength =
             //    this.serializedObject.FindProperty("_lodTransitionLength");
@@ -292,6 +311,39 @@ namespace CesiumForUnity
                 "soon as it is loaded completely.");
             EditorGUILayout.PropertyField(
                 this._loadingDescendantLimit, loadingDescendantLimitContent);
+
+            GUIContent mainThreadLoadingTimeLimitContent = new GUIContent(
+                "Main Thread Loading Time Limit",
+                "The maximum number of milliseconds per frame to spend on the main " +
+                "thread turning loaded tiles into game objects." +
+                "\n\n" +
+                "Creating the game objects, materials, and textures of a tile is spread " +
+                "across frames, one mesh at a time, with the tiles that have the largest " +
+                "screen-space error going first. A lower value keeps the frame rate " +
+                "steadier, at the cost of newly-loaded tiles taking longer to appear. " +
+                "Set this to 0 to disable the limit.");
+            EditorGUILayout.PropertyField(
+                this._mainThreadLoadingTimeLimit, mainThreadLoadingTimeLimitContent);
+
+            GUIContent tileCacheUnloadTimeLimitContent = new GUIContent(
+                "Tile Cache Unload Time Limit",
+                "The maximum number of milliseconds per frame to spend on the main " +
+                "thread unloading tiles that are no longer needed." +
+                "\n\n" +
+                "Set this to 0 to disable the limit.");
+            EditorGUILayout.PropertyField(
+                this._tileCacheUnloadTimeLimit, tileCacheUnloadTimeLimitContent);
+
+            GUIContent prefetchLookAheadTimeContent = new GUIContent(
+                "Prefetch Look Ahead Time",
+                "How many seconds ahead to predict the motion of each camera, so that " +
+                "tiles start loading before they come into view." +
+                "\n\n" +
+                "This reduces holes at the leading edge of fast camera motion, at the " +
+                "cost of loading some tiles that are never seen. " +
+                "Set this to 0 to disable prefetching.");
+            EditorGUILayout.PropertyField(
+                this._prefetchLookAheadTime, prefetchLookAheadTimeContent);
         }
 
         private void DrawTileCullingProperties()
@@ -385,6 +437,50 @@ namespace CesiumForUnity
                 "The Material to use to render opaque parts of tiles.");
             EditorGUILayout.PropertyField(this._opaqueMaterial, opaqueMaterialContent);
 
+            GUIContent combinePrimitivesContent = new GUIContent(
+                "Combine Primitives",
+                "Whether to combine the glTF primitives of each tile into as few meshes as possible." +
+                "\n\n" +
+                "Primitives that share a node transform and a vertex layout are written into a " +
+                "single mesh, each as its own sub-mesh with its own material. This reduces the " +
+                "number of game objects and renderers that are created for each tile. " +
+                "Primitives with feature metadata are never combined.");
+            EditorGUILayout.PropertyField(this._combinePrimitives, combinePrimitivesContent);
+
+            GUIContent normalFormatContent = new GUIContent(
+                "Normal Format",
+                "The format in which vertex normals are stored in the meshes of this tileset." +
+                "\n\n" +
+                "Smaller formats reduce GPU memory usage and upload bandwidth at the cost of " +
+                "some shading precision.");
+            EditorGUILayout.PropertyField(this._normalFormat, normalFormatContent);
+
+            GUIContent texCoordFormatContent = new GUIContent(
+                "Texture Coordinate Format",
+                "The format in which texture coordinates are stored in the meshes of this tileset." +
+                "\n\n" +
+                "Half-precision texture coordinates may show texture swimming on tiles with " +
+                "large, repeating texture coordinates.");
+            EditorGUILayout.PropertyField(this._texCoordFormat, texCoordFormatContent);
+
+            GUIContent quantizePositionsContent = new GUIContent(
+                "Quantize Positions",
+                "Whether to store vertex positions as 16-bit integers relative to the bounds " +
+                "of each mesh." +
+                "\n\n" +
+                "Positions are not quantized when \"Create Physics Meshes\" is enabled, " +
+                "because physics meshes require full-precision positions.");
+            EditorGUILayout.PropertyField(this._quantizePositions, quantizePositionsContent);
+
+            GUIContent compressTexturesContent = new GUIContent(
+                "Compress Textures",
+                "Whether to compress uncompressed, opaque textures to BC1 (DXT1) in a worker " +
+                "thread before they are uploaded to the GPU." +
+                "\n\n" +
+                "This reduces texture memory at the cost of some image quality. KTX2 textures " +
+                "are always transcoded to a compressed format supported by the device.");
+            EditorGUILayout.PropertyField(this._compressTextures, compressTexturesContent);
+
             //GUIContent useLodTransitionsContent = new GUIContent(
             //    "Use Lod Transitions",
             //    "Use a dithering effect when transitioning between tiles of different LODs." +
@@ -20,6 +20,43 @@ namespace CesiumForUnity
         FromUrl
     }
 
+    /// <summary>
+    /// Specifies the format in which vertex normals are stored in the meshes of a tileset.
+    /// </summary>
+    public enum CesiumNormalFormat
+    {
+        /// <summary>
+        /// Normals are stored as three 32-bit floats (12 bytes per vertex).
+        /// </summary>
+        Float32,
+
+        /// <summary>
+        /// Normals are stored as four normalized 16-bit signed integers (8 bytes per vertex).
+        /// </summary>
+        SNorm16,
+
+        /// <summary>
+        /// Normals are stored as four normalized 8-bit signed integers (4 bytes per vertex).
+        /// </summary>
+        SNorm8
+    }
+
+    /// <summary>
+    /// Specifies the format in which texture coordinates are stored in the meshes of a tileset.
+    /// </summary>
+    public enum CesiumTexCoordFormat
+    {
+        /// <summary>
+        /// Each texture coordinate set is stored as two 32-bit floats (8 bytes per vertex).
+        /// </summary>
+        Float32,
+
+        /// <summary>
+        /// Each texture coordinate set is stored as two 16-bit floats (4 bytes per vertex).
+        /// </summary>
+        Float16
+    }
+
     /// <summary>
     /// A tileset in the 3D Tiles format. <see href="https://github.com/CesiumGS/3d-tiles">3D Tiles</see>
     /// is an open specification for sharing, visualizing, fusing, and interacting with massive
@@ -318,6 +355,79 @@ namespace CesiumForUnity
             }
         }
 
+        [SerializeField]
+        [Min(0.0f)]
+        private float _mainThreadLoadingTimeLimit = 5.0f;
+
+        /// <summary>
+        /// The maximum number of milliseconds per frame to spend on the main thread
+        /// turning loaded tiles into game objects.
+        /// </summary>
+        /// <remarks>
+        /// Creating the game objects, materials, and textures of a tile is spread
+        /// across frames, one mesh at a time, with the tiles that have the largest
+        /// screen-space error going first. A lower value keeps the frame rate
+        /// steadier, at the cost of newly-loaded tiles taking longer to appear.
+        /// Set this to 0 to disable the limit.
+        /// </remarks>
+        public float mainThreadLoadingTimeLimit
+        {
+            get => this._mainThreadLoadingTimeLimit;
+            set
+            {
+                this._mainThreadLoadingTimeLimit = value;
+                this.RecreateTileset();
+            }
+        }
+
+        [SerializeField]
+        [Min(0.0f)]
+        private float _tileCacheUnloadTimeLimit = 5.0f;
+
+        /// <summary>
+        /// The maximum number of milliseconds per frame to spend on the main thread
+        /// unloading tiles that are no longer needed.
+        /// </summary>
+        /// <remarks>
+        /// Tiles that are not unloaded within this time are unloaded in later frames.
+        /// Set this to 0 to disable the limit.
+        /// </remarks>
+        public float tileCacheUnloadTimeLimit
+        {
+            get => this._tileCacheUnloadTimeLimit;
+            set
+            {
+                this._tileCacheUnloadTimeLimit = value;
+                this.RecreateTileset();
+            }
+        }
+
+        [SerializeField]
+        [Min(0.0f)]
+        private float _prefetchLookAheadTime = 0.0f;
+
+        /// <summary>
+        /// How many seconds ahead to predict the motion of each camera, so that tiles start
+        /// loading before they come into view.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// Each moving camera's position is extrapolated from its recent velocity, and tiles
+        /// are selected for the predicted view as well as the current one. This reduces holes
+        /// at the leading edge of fast camera motion, at the cost of loading some tiles that
+        /// are never seen. Use <see cref="GetPrefetchHitCount"/> and
+        /// <see cref="GetPrefetchWasteCount"/> to tune it.
+        /// </para>
+        /// <para>
+        /// Set this to 0 to disable prefetching.
+        /// </para>
+        /// </remarks>
+        public float prefetchLookAheadTime
+        {
+            get => this._prefetchLookAheadTime;
+            set { this._prefetchLookAheadTime = value; }
+        }
+
         [SerializeField]
         private bool _enableFrustumCulling = true;
 
@@ -467,6 +577,125 @@ namespace CesiumForUnity
             }
         }
 
+        [SerializeField]
+        private bool _combinePrimitives = false;
+
+        /// <summary>
+        /// Whether to combine the glTF primitives of each tile into as few meshes as possible.
+        /// </summary>
+        /// <remarks>
+        /// Primitives that share a node transform and a vertex layout are written into a
+        /// single mesh, each as its own sub-mesh with its own material. This reduces the
+        /// number of game objects and renderers that are created for each tile. Primitives
+        /// with feature metadata are never combined.
+        /// </remarks>
+        public bool combinePrimitives
+        {
+            get => this._combinePrimitives;
+            set
+            {
+                this._combinePrimitives = value;
+                this.RecreateTileset();
+            }
+        }
+
+        [SerializeField]
+        private CesiumNormalFormat _normalFormat = CesiumNormalFormat.Float32;
+
+        /// <summary>
+        /// The format in which vertex normals are stored in the meshes of this tileset.
+        /// </summary>
+        /// <remarks>
+        /// Smaller formats reduce GPU memory usage and upload bandwidth at the cost of
+        /// some shading precision.
+        /// </remarks>
+        public CesiumNormalFormat normalFormat
+        {
+            get => this._normalFormat;
+            set
+            {
+                this._normalFormat = value;
+                this.RecreateTileset();
+            }
+        }
+
+        [SerializeField]
+        private CesiumTexCoordFormat _texCoordFormat = CesiumTexCoordFormat.Float32;
+
+        /// <summary>
+        /// The format in which texture coordinates are stored in the meshes of this tileset.
+        /// </summary>
+        /// <remarks>
+        /// Half-precision texture coordinates may show texture swimming on tiles with large,
+        /// repeating texture coordinates.
+        /// </remarks>
+        public CesiumTexCoordFormat texCoordFormat
+        {
+            get => this._texCoordFormat;
+            set
+            {
+                this._texCoordFormat = value;
+                this.RecreateTileset();
+            }
+        }
+
+        [SerializeField]
+        private bool _quantizePositions = false;
+
+        /// <summary>
+        /// Whether to store vertex positions as 16-bit integers relative to the bounds of each mesh.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// Quantized positions use 8 bytes per vertex instead of 12. The precision of the
+        /// positions is 1/65535th of the largest dimension of each mesh.
+        /// </para>
+        /// <para>
+        /// Positions are not quantized when <see cref="createPhysicsMeshes"/> is enabled,
+        /// because physics meshes require full-precision positions.
+        /// </para>
+        /// </remarks>
+        public bool quantizePositions
+        {
+            get => this._quantizePositions;
+            set
+            {
+                this._quantizePositions = value;
+                this.RecreateTileset();
+            }
+        }
+
+        [SerializeField]
+        private bool _compressTextures = false;
+
+        /// <summary>
+        /// Whether to compress uncompressed, opaque base color and raster overlay textures
+        /// to BC1 (DXT1) in a worker thread before they are uploaded to the GPU.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// BC1 textures use an eighth of the memory of RGBA32 textures, at the cost of
+        /// some image quality. Textures with transparency are never compressed, and
+        /// neither are normal, metallic-roughness, occlusion, and emissive textures,
+        /// which BC1 degrades too much. Textures whose width or height is not a
+        /// multiple of 4 are also left uncompressed, because BC1 stores pixels in 4x4
+        /// blocks. This has no effect on devices that do not support BC1 textures.
+        /// </para>
+        /// <para>
+        /// KTX2 textures are always transcoded to the best compressed format supported
+        /// by the device, whether or not this option is enabled.
+        /// </para>
+        /// </remarks>
+        public bool compressTextures
+        {
+            get => this._compressTextures;
+            set
+            {
+                this._compressTextures = value;
+                this.RecreateTileset();
+            }
+        }
+
         //[SerializeField]
         //private bool _useLodTransitions = false;
 
@@ -630,5 +859,35 @@ namespace CesiumForUnity
         /// Zoom the Editor camera to this tileset. This method does nothing outside of the Editor.
         /// </summary>
         public partial void FocusTileset();
+
+        /// <summary>
+        /// Gets the number of tile game objects that were activated or deactivated by the most
+        /// recent update of this tileset.
+        /// </summary>
+        /// <remarks>
+        /// Tile game objects are only activated or deactivated when their visibility changes,
+        /// so this is zero while the camera and the loaded tiles are unchanged.
+        /// </remarks>
+        /// <returns>The number of tile game objects whose active state changed.</returns>
+        public partial int GetTileActivationCount();
+
+        /// <summary>
+        /// Gets the number of tiles that were loaded for a predicted camera view and were then
+        /// seen by a camera.
+        /// </summary>
+        /// <remarks>
+        /// A tile counts as prefetched when it is rendered but no camera can see it. This is an
+        /// approximation: with frustum culling disabled, tiles outside the view are also
+        /// counted.
+        /// </remarks>
+        /// <returns>The number of prefetched tiles that were used.</returns>
+        public partial long GetPrefetchHitCount();
+
+        /// <summary>
+        /// Gets the number of tiles that were loaded for a predicted camera view and stopped
+        /// being rendered without any camera seeing them.
+        /// </summary>
+        /// <returns>The number of prefetched tiles that were never used.</returns>
+        public partial long GetPrefetchWasteCount();
     }
 }
@@ -0,0 +1,112 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace CesiumForUnity
+{
+    /// <summary>
+    /// Registers cameras, in addition to the main camera, that every <see cref="Cesium3DTileset"/>
+    /// selects tiles for.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// By default, tilesets only load and render tiles for <see cref="Camera.main"/> and, in
+    /// the Editor, the last active scene view. Registering the cameras of additional viewports,
+    /// such as a minimap, lets a single tileset select tiles for all of them at once, sharing
+    /// its tile cache between the viewports.
+    /// </para>
+    /// <para>
+    /// Each camera may be given a screen-space error scale. Tiles are refined for a camera
+    /// as if its viewport were this many times larger, so a scale below 1.0 loads less detail
+    /// for a camera that does not need it, and a scale above 1.0 loads more.
+    /// </para>
+    /// </remarks>
+    public static class CesiumCameraManager
+    {
+        private struct CameraRegistration
+        {
+            public Camera camera;
+            public float screenSpaceErrorScale;
+        }
+
+        private static readonly List<CameraRegistration> _cameras = new List<CameraRegistration>();
+
+        /// <summary>
+        /// Registers a camera that tilesets should select tiles for.
+        /// </summary>
+        /// <param name="camera">The camera.</param>
+        public static void AddCamera(Camera camera)
+        {
+            AddCamera(camera, 1.0f);
+        }
+
+        /// <summary>
+        /// Registers a camera that tilesets should select tiles for, or changes the
+        /// screen-space error scale of a camera that is already registered.
+        /// </summary>
+        /// <param name="camera">The camera.</param>
+        /// <param name="screenSpaceErrorScale">
+        /// The factor that the screen-space error of tiles seen by this camera is multiplied by.
+        /// Must be greater than zero.
+        /// </param>
+        /// <exception cref="ArgumentOutOfRangeException">
+        /// The screen-space error scale is zero, negative, or NaN.
+        /// </exception>
+        public static void AddCamera(Camera camera, float screenSpaceErrorScale)
+        {
+            if (!(screenSpaceErrorScale > 0.0f))
+            {
+                throw new ArgumentOutOfRangeException(
+                    nameof(screenSpaceErrorScale),
+                    screenSpaceErrorScale,
+                    "The screen-space error scale must be greater than zero.");
+            }
+
+            if (camera == null)
+            {
+                return;
+            }
+
+            CameraRegistration registration = new CameraRegistration
+            {
+                camera = camera,
+                screenSpaceErrorScale = screenSpaceErrorScale
+            };
+
+            int index = _cameras.FindIndex(r => r.camera == camera);
+            if (index >= 0)
+            {
+                _cameras[index] = registration;
+            }
+            else
+            {
+                _cameras.Add(registration);
+            }
+        }
+
+        /// <summary>
+        /// Unregisters a camera that was added with <see cref="AddCamera(Camera)"/>.
+        /// </summary>
+        /// <param name="camera">The camera.</param>
+        /// <returns>True if the camera was registered, otherwise false.</returns>
+        public static bool RemoveCamera(Camera camera)
+        {
+            return _cameras.RemoveAll(r => r.camera == camera) > 0;
+        }
+
+        internal static int GetCameraCount()
+        {
+            return _cameras.Count;
+        }
+
+        internal static Camera GetCamera(int index)
+        {
+            return _cameras[index].camera;
+        }
+
+        internal static float GetScreenSpaceErrorScale(int index)
+        {
+            return _cameras[index].screenSpaceErrorScale;
+        }
+    }
+}
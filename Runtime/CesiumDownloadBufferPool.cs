@@ -0,0 +1,56 @@
+using Reinterop;
+
+namespace CesiumForUnity
+{
+    /// <summary>
+    /// Reports statistics about the buffers that downloaded tiles and other assets are received
+    /// into.
+    /// </summary>
+    /// <remarks>
+    /// Each response is received into a buffer sized from its <c>Content-Length</c> header and
+    /// taken from a pool of buffers left over from earlier responses. When the length is known,
+    /// every byte is copied exactly once. Responses without a length, or whose body is larger
+    /// than the length, are copied again each time their buffer grows. The average number of
+    /// bytes copied per response is <see cref="GetBytesCopied"/> divided by
+    /// <see cref="GetResponseCount"/>.
+    /// </remarks>
+    [ReinteropNativeImplementation("CesiumForUnityNative::CesiumDownloadBufferPoolImpl", "CesiumDownloadBufferPoolImpl.h", staticOnly: true)]
+    public static partial class CesiumDownloadBufferPool
+    {
+        /// <summary>
+        /// Gets the number of responses received.
+        /// </summary>
+        /// <returns>The number of responses since the statistics were last reset.</returns>
+        public static partial long GetResponseCount();
+
+        /// <summary>
+        /// Gets the total size of the bodies of all responses received.
+        /// </summary>
+        /// <returns>The number of bytes received since the statistics were last reset.</returns>
+        public static partial long GetBytesReceived();
+
+        /// <summary>
+        /// Gets the number of bytes copied to receive all responses, including the copies made
+        /// when a buffer had to grow.
+        /// </summary>
+        /// <returns>The number of bytes copied since the statistics were last reset.</returns>
+        public static partial long GetBytesCopied();
+
+        /// <summary>
+        /// Gets the number of times a buffer had to grow while receiving a response.
+        /// </summary>
+        /// <returns>The number of reallocations since the statistics were last reset.</returns>
+        public static partial long GetReallocationCount();
+
+        /// <summary>
+        /// Gets the number of unused buffers currently held by the pool.
+        /// </summary>
+        /// <returns>The number of pooled buffers.</returns>
+        public static partial int GetPooledBufferCount();
+
+        /// <summary>
+        /// Resets the response, byte, and reallocation counts to zero.
+        /// </summary>
+        public static partial void ResetStatistics();
+    }
+}
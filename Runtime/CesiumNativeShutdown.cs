@@ -0,0 +1,38 @@
+using Reinterop;
+using UnityEngine;
+
+#if UNITY_EDITOR
+using UnityEditor;
+#endif
+
+namespace CesiumForUnity
+{
+    /// <summary>
+    /// Stops the native threads that download and load tiles before the application exits.
+    /// </summary>
+    /// <remarks>
+    /// These threads are shared by all tilesets and would otherwise only be stopped by static
+    /// destruction while the native library is unloaded, which can hang if a download is in
+    /// flight. In the Editor this happens when the Editor quits rather than when leaving play
+    /// mode, because the threads are also used by tilesets in edit mode.
+    /// </remarks>
+    [ReinteropNativeImplementation("CesiumForUnityNative::CesiumNativeShutdownImpl", "CesiumNativeShutdownImpl.h", staticOnly: true)]
+    internal static partial class CesiumNativeShutdown
+    {
+#if UNITY_EDITOR
+        [InitializeOnLoadMethod]
+        private static void RegisterShutdown()
+        {
+            EditorApplication.quitting += Shutdown;
+        }
+#else
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.BeforeSceneLoad)]
+        private static void RegisterShutdown()
+        {
+            Application.quitting += Shutdown;
+        }
+#endif
+
+        private static partial void Shutdown();
+    }
+}
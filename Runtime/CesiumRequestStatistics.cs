@@ -0,0 +1,99 @@
+using Reinterop;
+
+namespace CesiumForUnity
+{
+    /// <summary>
+    /// Reports statistics about the requests that tilesets and raster overlays make for tiles
+    /// and other assets.
+    /// </summary>
+    /// <remarks>
+    /// While a GET request is in flight, later requests for the same URL with the same headers
+    /// wait for it to complete instead of issuing a request of their own. This commonly
+    /// happens when several tilesets share terrain, imagery, or a root tileset. Requests that
+    /// are issued look in the request cache, which is configured in
+    /// <see cref="CesiumRuntimeSettings"/>, before they are downloaded.
+    /// </remarks>
+    [ReinteropNativeImplementation("CesiumForUnityNative::CesiumRequestStatisticsImpl", "CesiumRequestStatisticsImpl.h", staticOnly: true)]
+    public static partial class CesiumRequestStatistics
+    {
+        /// <summary>
+        /// Gets the number of GET requests that were issued because no identical request was
+        /// in flight.
+        /// </summary>
+        /// <returns>The number of issued requests since the statistics were last reset.</returns>
+        public static partial long GetIssuedRequestCount();
+
+        /// <summary>
+        /// Gets the number of GET requests that were served by an identical request that was
+        /// already in flight.
+        /// </summary>
+        /// <returns>The number of coalesced requests since the statistics were last reset.</returns>
+        public static partial long GetCoalescedRequestCount();
+
+        /// <summary>
+        /// Gets the number of distinct GET requests currently in flight.
+        /// </summary>
+        /// <returns>The number of in-flight requests.</returns>
+        public static partial int GetInFlightRequestCount();
+
+        /// <summary>
+        /// Gets the number of requests that were served a response from the request cache
+        /// without asking the server. This includes the expired responses counted by
+        /// <see cref="GetCacheStaleHitCount"/>, which are served while they are revalidated.
+        /// </summary>
+        /// <returns>The number of cache hits since the statistics were last reset.</returns>
+        public static partial long GetCacheHitCount();
+
+        /// <summary>
+        /// Gets the number of requests that found an expired response in the request cache and
+        /// had to revalidate it with the server before using it. These are not included in
+        /// <see cref="GetCacheHitCount"/>.
+        /// </summary>
+        /// <returns>The number of expired lookups since the statistics were last reset.</returns>
+        public static partial long GetCacheExpiredCount();
+
+        /// <summary>
+        /// Gets the number of requests that found no response in the request cache.
+        /// </summary>
+        /// <returns>The number of cache misses since the statistics were last reset.</returns>
+        public static partial long GetCacheMissCount();
+
+        /// <summary>
+        /// Gets the number of responses that were written to the request cache.
+        /// </summary>
+        /// <returns>The number of cache stores since the statistics were last reset.</returns>
+        public static partial long GetCacheStoreCount();
+
+        /// <summary>
+        /// Gets the number of times the least recently used responses were evicted from the
+        /// request cache to bring it back within
+        /// <see cref="CesiumRuntimeSettings.requestCacheMaximumItems"/>.
+        /// </summary>
+        /// <returns>The number of evictions since the statistics were last reset.</returns>
+        public static partial long GetCachePruneCount();
+
+        /// <summary>
+        /// Gets the number of requests that were served an expired response from the request
+        /// cache while it was revalidated in the background. These are included in
+        /// <see cref="GetCacheHitCount"/>.
+        /// </summary>
+        /// <remarks>
+        /// This is only counted when
+        /// <see cref="CesiumRuntimeSettings.requestCacheStaleWhileRevalidate"/> is enabled.
+        /// </remarks>
+        /// <returns>The number of stale hits since the statistics were last reset.</returns>
+        public static partial long GetCacheStaleHitCount();
+
+        /// <summary>
+        /// Gets the number of expired responses that were revalidated with the server in the
+        /// background after they were served from the request cache.
+        /// </summary>
+        /// <returns>The number of revalidations since the statistics were last reset.</returns>
+        public static partial long GetCacheRevalidationCount();
+
+        /// <summary>
+        /// Resets all request and cache counts to zero.
+        /// </summary>
+        public static partial void ResetStatistics();
+    }
+}
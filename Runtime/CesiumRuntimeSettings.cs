@@ -6,6 +6,58 @@ using UnityEditor;
 
 namespace CesiumForUnity
 {
+    /// <summary>
+    /// Specifies how Cesium runs the background work of loading tiles, such as decoding
+    /// content and building meshes.
+    /// </summary>
+    public enum CesiumTaskProcessorType
+    {
+        /// <summary>
+        /// Tasks are run on the .NET thread pool with <c>Task.Run</c>, shared with game code.
+        /// </summary>
+        DotNetThreadPool,
+
+        /// <summary>
+        /// Tasks are run on a dedicated pool of native worker threads that never call into
+        /// managed code. The number of threads and the processors they run on are set with
+        /// <see cref="CesiumRuntimeSettings.nativeThreadPoolThreadCount"/> and
+        /// <see cref="CesiumRuntimeSettings.nativeThreadPoolAffinityMask"/>.
+        /// </summary>
+        NativeThreadPool,
+
+        /// <summary>
+        /// Like <see cref="NativeThreadPool"/>, but tasks are queued in high, medium, and low
+        /// priority lanes, following the tile load priority groups of each tileset. Workers
+        /// always take from the highest lane with work, and the low lane is paused while
+        /// loaded tiles are waiting for the main thread. The depth of each lane is reported
+        /// by <see cref="CesiumTaskProcessor.GetQueuedTaskCount"/>.
+        /// </summary>
+        PriorityThreadPool
+    }
+
+    /// <summary>
+    /// Specifies how Cesium downloads tiles and other assets.
+    /// </summary>
+    public enum CesiumAssetAccessorType
+    {
+        /// <summary>
+        /// Assets are downloaded with <c>UnityWebRequest</c>. Every request is started and
+        /// completed on the main thread, so the rate at which requests are issued follows the
+        /// frame rate.
+        /// </summary>
+        UnityWebRequest,
+
+        /// <summary>
+        /// Assets are downloaded by a native HTTP client on its own threads, without waiting
+        /// for the main thread. Connections are kept alive and reused, and the number of
+        /// requests in flight is set with
+        /// <see cref="CesiumRuntimeSettings.nativeHttpMaximumConcurrentRequests"/>. URLs the
+        /// native client cannot load, such as <c>file:</c> URLs, and <c>https:</c> URLs on
+        /// platforms where it is built without TLS support, still use <c>UnityWebRequest</c>.
+        /// </summary>
+        NativeHttp
+    }
+
     /// <summary>
     /// Holds Cesium settings used at runtime.
     /// </summary>
@@ -157,5 +209,372 @@ namespace CesiumForUnity
             }
             #endif
         }
+
+        [SerializeField]
+        [Min(0)]
+        private int _maximumPooledTextures = 128;
+
+        /// <summary>
+        /// The maximum number of unused raster overlay textures to keep for reuse, across all
+        /// tilesets.
+        /// </summary>
+        /// <remarks>
+        /// Reusing textures avoids creating and destroying a texture every time a raster
+        /// overlay tile is loaded and unloaded. Reused textures are refilled through one staging
+        /// texture per size and format, which keeps a copy of its pixels in system memory. On
+        /// devices that cannot copy textures on the GPU, every pooled texture keeps such a copy
+        /// instead. Set this to 0 to disable the pool.
+        /// Changes take effect the next time a tileset is loaded.
+        /// </remarks>
+        public static int maximumPooledTextures
+        {
+            get => instance._maximumPooledTextures;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._maximumPooledTextures = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        [Min(0)]
+        private int _maximumPooledTexturesPerSize = 32;
+
+        /// <summary>
+        /// The maximum number of unused raster overlay textures of any one size and format to
+        /// keep for reuse.
+        /// </summary>
+        /// <remarks>
+        /// Changes take effect the next time a tileset is loaded.
+        /// </remarks>
+        public static int maximumPooledTexturesPerSize
+        {
+            get => instance._maximumPooledTexturesPerSize;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._maximumPooledTexturesPerSize = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        private CesiumTaskProcessorType _taskProcessorType = CesiumTaskProcessorType.DotNetThreadPool;
+
+        /// <summary>
+        /// How the background work of loading tiles is run.
+        /// </summary>
+        /// <remarks>
+        /// The task processor is created when the first tileset is loaded, so changes take
+        /// effect the next time the application or the Editor is started.
+        /// </remarks>
+        public static CesiumTaskProcessorType taskProcessorType
+        {
+            get => instance._taskProcessorType;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._taskProcessorType = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        [Min(0)]
+        private int _nativeThreadPoolThreadCount = 0;
+
+        /// <summary>
+        /// The number of worker threads used when <see cref="taskProcessorType"/> is
+        /// <see cref="CesiumTaskProcessorType.NativeThreadPool"/> or
+        /// <see cref="CesiumTaskProcessorType.PriorityThreadPool"/>, or 0 to use one fewer than
+        /// the number of logical processors.
+        /// </summary>
+        public static int nativeThreadPoolThreadCount
+        {
+            get => instance._nativeThreadPoolThreadCount;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._nativeThreadPoolThreadCount = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        private long _nativeThreadPoolAffinityMask = 0;
+
+        /// <summary>
+        /// A mask of the logical processors that the worker threads may run on when
+        /// <see cref="taskProcessorType"/> is <see cref="CesiumTaskProcessorType.NativeThreadPool"/>
+        /// or <see cref="CesiumTaskProcessorType.PriorityThreadPool"/>, where bit i is
+        /// processor i. Use 0 to let them run on any processor.
+        /// </summary>
+        /// <remarks>
+        /// The mask is applied on Windows, Linux, and Android. It is ignored on macOS and iOS,
+        /// which do not allow threads to be bound to processors.
+        /// </remarks>
+        public static long nativeThreadPoolAffinityMask
+        {
+            get => instance._nativeThreadPoolAffinityMask;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._nativeThreadPoolAffinityMask = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        private CesiumAssetAccessorType _assetAccessorType = CesiumAssetAccessorType.UnityWebRequest;
+
+        /// <summary>
+        /// How tiles and other assets are downloaded.
+        /// </summary>
+        /// <remarks>
+        /// The asset accessor is created when the first tileset is loaded, so changes take
+        /// effect the next time the application or the Editor is started.
+        /// </remarks>
+        public static CesiumAssetAccessorType assetAccessorType
+        {
+            get => instance._assetAccessorType;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._assetAccessorType = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        [Min(1)]
+        private int _nativeHttpMaximumConcurrentRequests = 16;
+
+        /// <summary>
+        /// The maximum number of requests in flight at once when <see cref="assetAccessorType"/>
+        /// is <see cref="CesiumAssetAccessorType.NativeHttp"/>. Each concurrent request uses its
+        /// own native thread, which spends most of its time waiting on the network.
+        /// </summary>
+        public static int nativeHttpMaximumConcurrentRequests
+        {
+            get => instance._nativeHttpMaximumConcurrentRequests;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._nativeHttpMaximumConcurrentRequests = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        [Min(1)]
+        private int _nativeHttpMaximumConnectionsPerHost = 8;
+
+        /// <summary>
+        /// The maximum number of idle keep-alive connections kept open to each host when
+        /// <see cref="assetAccessorType"/> is <see cref="CesiumAssetAccessorType.NativeHttp"/>.
+        /// </summary>
+        public static int nativeHttpMaximumConnectionsPerHost
+        {
+            get => instance._nativeHttpMaximumConnectionsPerHost;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._nativeHttpMaximumConnectionsPerHost = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        private string _requestCachePath = "";
+
+        /// <summary>
+        /// The path of the SQLite database that downloaded tiles and other assets are cached in.
+        /// If empty, <c>cesium-request-cache.sqlite</c> in <see cref="Application.temporaryCachePath"/>
+        /// is used.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// Processes that share a cache database take turns writing to it, and a response that
+        /// can't be written while another process holds the lock is simply not cached. Give
+        /// applications that run side by side on the same machine their own paths.
+        /// </para>
+        /// <para>
+        /// The cache is opened when the first tileset is loaded, so changes take effect the next
+        /// time the application or the Editor is started.
+        /// </para>
+        /// </remarks>
+        public static string requestCachePath
+        {
+            get => instance._requestCachePath;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._requestCachePath = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        [Min(1)]
+        private int _requestCacheMaximumItems = 4096;
+
+        /// <summary>
+        /// The maximum number of responses kept in the request cache. When the cache grows past
+        /// this, the least recently used responses are evicted.
+        /// </summary>
+        /// <remarks>
+        /// The cache is bounded by the number of responses rather than their total size. Divide
+        /// the disk space to use by the typical size of a tile to choose a value; tiles are
+        /// commonly tens to hundreds of kilobytes.
+        /// </remarks>
+        public static int requestCacheMaximumItems
+        {
+            get => instance._requestCacheMaximumItems;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._requestCacheMaximumItems = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        [Min(1)]
+        private int _requestCacheRequestsPerPrune = 10000;
+
+        /// <summary>
+        /// The number of requests between evictions from the request cache. Evicting less
+        /// often does less work overall, but lets the cache briefly exceed
+        /// <see cref="requestCacheMaximumItems"/> by up to this many responses.
+        /// </summary>
+        public static int requestCacheRequestsPerPrune
+        {
+            get => instance._requestCacheRequestsPerPrune;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._requestCacheRequestsPerPrune = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        private bool _requestCacheStaleWhileRevalidate = false;
+
+        /// <summary>
+        /// Whether expired responses in the request cache are used right away while they are
+        /// revalidated with the server in the background.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// When disabled, an expired response is revalidated before it can be used, so tiles
+        /// whose cached copies have expired wait for a round trip to the server before they
+        /// render. When enabled, they render immediately from the cache, and the cache is
+        /// updated afterward if the server has newer content, so the newer content is used the
+        /// next time the tile is loaded.
+        /// </para>
+        /// <para>
+        /// Responses that expired more than <see cref="requestCacheMaximumStaleness"/> seconds
+        /// ago, and responses whose <c>Cache-Control</c> header includes <c>no-cache</c> or
+        /// <c>must-revalidate</c>, are always revalidated first.
+        /// </para>
+        /// </remarks>
+        public static bool requestCacheStaleWhileRevalidate
+        {
+            get => instance._requestCacheStaleWhileRevalidate;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._requestCacheStaleWhileRevalidate = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        [Min(0)]
+        private int _requestCacheMaximumStaleness = 7 * 24 * 60 * 60;
+
+        /// <summary>
+        /// The longest time, in seconds, after a cached response expires that it may still be
+        /// used while it is revalidated, when <see cref="requestCacheStaleWhileRevalidate"/> is
+        /// enabled.
+        /// </summary>
+        public static int requestCacheMaximumStaleness
+        {
+            get => instance._requestCacheMaximumStaleness;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._requestCacheMaximumStaleness = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
+
+        [SerializeField]
+        private string _tilePackPath = "";
+
+        /// <summary>
+        /// The path of a tile pack to load tiles and other assets from before looking in the
+        /// request cache or downloading them, or empty to not use one. Tile packs are recorded
+        /// with <see cref="CesiumTilePack.StartRecording"/>.
+        /// </summary>
+        /// <remarks>
+        /// The tile pack is memory-mapped, so it must be a regular file on the device. It can't
+        /// be inside an Android APK. It is opened when the first tileset is loaded, so changes
+        /// take effect the next time the application or the Editor is started.
+        /// </remarks>
+        public static string tilePackPath
+        {
+            get => instance._tilePackPath;
+            #if UNITY_EDITOR
+            set
+            {
+                instance._tilePackPath = value;
+                EditorUtility.SetDirty(_instance);
+                AssetDatabase.SaveAssetIfDirty(_instance);
+                AssetDatabase.Refresh();
+            }
+            #endif
+        }
     }
 }
\ No newline at end of file
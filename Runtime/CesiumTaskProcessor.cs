@@ -0,0 +1,47 @@
+using Reinterop;
+
+namespace CesiumForUnity
+{
+    /// <summary>
+    /// The priority lanes of the <see cref="CesiumTaskProcessorType.PriorityThreadPool"/> task
+    /// processor.
+    /// </summary>
+    public enum CesiumTaskPriority
+    {
+        /// <summary>
+        /// Work for tilesets that are loading tiles needed to fill holes in the current view.
+        /// </summary>
+        High,
+
+        /// <summary>
+        /// Work for tilesets that are refining the current view, and work not started by a
+        /// tileset.
+        /// </summary>
+        Medium,
+
+        /// <summary>
+        /// Work for tilesets that are only preloading tiles, such as siblings and ancestors of
+        /// visible tiles. This lane is paused while loaded tiles are waiting for the main
+        /// thread.
+        /// </summary>
+        Low
+    }
+
+    /// <summary>
+    /// Reports the state of the task processor that runs the background work of loading tiles.
+    /// </summary>
+    [ReinteropNativeImplementation("CesiumForUnityNative::CesiumTaskProcessorImpl", "CesiumTaskProcessorImpl.h", staticOnly: true)]
+    public static partial class CesiumTaskProcessor
+    {
+        /// <summary>
+        /// Gets the number of tasks waiting to run in a priority lane.
+        /// </summary>
+        /// <param name="priority">The priority lane.</param>
+        /// <returns>
+        /// The number of queued tasks, or 0 if <see cref="CesiumRuntimeSettings.taskProcessorType"/>
+        /// is not <see cref="CesiumTaskProcessorType.PriorityThreadPool"/> or no tileset has been
+        /// loaded yet.
+        /// </returns>
+        public static partial int GetQueuedTaskCount(CesiumTaskPriority priority);
+    }
+}
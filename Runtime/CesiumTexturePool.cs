@@ -0,0 +1,40 @@
+using Reinterop;
+
+namespace CesiumForUnity
+{
+    /// <summary>
+    /// Reports statistics about the pool of textures that raster overlay tiles reuse instead of
+    /// creating and destroying a texture for every tile.
+    /// </summary>
+    /// <remarks>
+    /// The size of the pool is controlled by <see cref="CesiumRuntimeSettings.maximumPooledTextures"/>
+    /// and <see cref="CesiumRuntimeSettings.maximumPooledTexturesPerSize"/>.
+    /// </remarks>
+    [ReinteropNativeImplementation("CesiumForUnityNative::CesiumTexturePoolImpl", "CesiumTexturePoolImpl.h", staticOnly: true)]
+    public static partial class CesiumTexturePool
+    {
+        /// <summary>
+        /// Gets the number of raster overlay textures that were reused from the pool.
+        /// </summary>
+        /// <returns>The number of pool hits since the statistics were last reset.</returns>
+        public static partial long GetHitCount();
+
+        /// <summary>
+        /// Gets the number of raster overlay textures that had to be created because the pool
+        /// had no texture of the same size and format.
+        /// </summary>
+        /// <returns>The number of pool misses since the statistics were last reset.</returns>
+        public static partial long GetMissCount();
+
+        /// <summary>
+        /// Gets the number of unused textures currently held by the pool.
+        /// </summary>
+        /// <returns>The number of pooled textures.</returns>
+        public static partial int GetPooledTextureCount();
+
+        /// <summary>
+        /// Resets the hit and miss counts to zero.
+        /// </summary>
+        public static partial void ResetStatistics();
+    }
+}
@@ -0,0 +1,82 @@
+using Reinterop;
+
+namespace CesiumForUnity
+{
+    /// <summary>
+    /// Records and reports on tile packs, single files holding the tiles and other assets for a
+    /// region so that they can be loaded without a network connection.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// To build a tile pack, call <see cref="StartRecording"/>, then load the tilesets and
+    /// raster overlays that should be available offline and move the cameras over the region
+    /// at the levels of detail that will be needed, for example by registering several cameras
+    /// with <see cref="CesiumCameraManager"/>. Every asset that is loaded successfully is
+    /// added to the pack. Call <see cref="StopRecording"/> to write it.
+    /// </para>
+    /// <para>
+    /// To use a tile pack, set <see cref="CesiumRuntimeSettings.tilePackPath"/>. Requests for
+    /// assets in the pack are served directly from the memory-mapped file, and all other
+    /// requests fall back to the request cache and the network. Cesium ion access tokens are
+    /// ignored when matching requests, so packs keep working after the tokens they were
+    /// recorded with expire.
+    /// </para>
+    /// </remarks>
+    [ReinteropNativeImplementation("CesiumForUnityNative::CesiumTilePackImpl", "CesiumTilePackImpl.h", staticOnly: true)]
+    public static partial class CesiumTilePack
+    {
+        /// <summary>
+        /// Starts recording every asset that tilesets and raster overlays load into a new tile
+        /// pack. A recording already in progress is discarded.
+        /// </summary>
+        /// <param name="path">The path to write the tile pack to. It is written to a temporary
+        /// file next to this path until <see cref="StopRecording"/> is called. It can't be the
+        /// <see cref="CesiumRuntimeSettings.tilePackPath"/> of the tile pack being used, which
+        /// can't be replaced while it is open.</param>
+        /// <returns>True if recording started, or false if the file could not be created or the
+        /// path is that of the tile pack being used.</returns>
+        public static partial bool StartRecording(string path);
+
+        /// <summary>
+        /// Stops recording and writes the tile pack.
+        /// </summary>
+        /// <returns>True if a tile pack was being recorded and was written successfully.</returns>
+        public static partial bool StopRecording();
+
+        /// <summary>
+        /// Gets whether a tile pack is being recorded.
+        /// </summary>
+        /// <returns>True if a tile pack is being recorded.</returns>
+        public static partial bool IsRecording();
+
+        /// <summary>
+        /// Gets the number of assets added to the tile pack being recorded.
+        /// </summary>
+        /// <returns>The number of recorded assets, or 0 if nothing is being recorded.</returns>
+        public static partial int GetRecordedEntryCount();
+
+        /// <summary>
+        /// Gets the number of assets in the tile pack set by
+        /// <see cref="CesiumRuntimeSettings.tilePackPath"/>.
+        /// </summary>
+        /// <returns>The number of assets, or 0 if no tile pack is loaded.</returns>
+        public static partial int GetEntryCount();
+
+        /// <summary>
+        /// Gets the number of requests served from the tile pack.
+        /// </summary>
+        /// <returns>The number of hits since the statistics were last reset.</returns>
+        public static partial long GetHitCount();
+
+        /// <summary>
+        /// Gets the number of requests for assets that the tile pack did not have.
+        /// </summary>
+        /// <returns>The number of misses since the statistics were last reset.</returns>
+        public static partial long GetMissCount();
+
+        /// <summary>
+        /// Resets the hit and miss counts to zero.
+        /// </summary>
+        public static partial void ResetStatistics();
+    }
+}
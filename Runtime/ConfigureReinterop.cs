@@ -70,6 +70,11 @@ namespace CesiumForUnity
             int pixelHeight = c.pixelHeight;
             int pixelWidth = c.pixelWidth;
             float aspect = c.aspect;
+            int cameraCount = CesiumCameraManager.GetCameraCount();
+            c = CesiumCameraManager.GetCamera(0);
+            float screenSpaceErrorScale = CesiumCameraManager.GetScreenSpaceErrorScale(0);
+            bool cameraEnabled = c.isActiveAndEnabled;
+            int cameraID = c.GetInstanceID();
             //IFormattable f = new Vector3();
             //IEquatable<Vector3> f2 = new Vector3();
 
@@ -100,6 +105,15 @@ namespace CesiumForUnity
             go.hideFlags = HideFlags.DontSave;
 
             Texture2D texture2D = new Texture2D(256, 256, TextureFormat.RGBA32, false, false);
+            texture2D = new Texture2D(256, 256, TextureFormat.RGBA32, 1, false);
+            int textureWidth = texture2D.width;
+            int textureHeight = texture2D.height;
+            TextureFormat textureFormat = texture2D.format;
+            int textureMipCount = texture2D.mipmapCount;
+            bool textureIsReadable = texture2D.isReadable;
+            bool supportsFormat = SystemInfo.SupportsTextureFormat(TextureFormat.RGBA32);
+            CopyTextureSupport copyTextureSupport = SystemInfo.copyTextureSupport;
+            Graphics.CopyTexture(texture2D, texture2D);
             texture2D.LoadRawTextureData(IntPtr.Zero, 0);
             NativeArray<byte> textureBytes = texture2D.GetRawTextureData<byte>();
 
@@ -131,6 +145,8 @@ namespace CesiumForUnity
             int instanceID = mesh.GetInstanceID();
 
             Bounds bounds = new Bounds(new Vector3(0, 0, 0), new Vector3(1, 2, 1));
+            bounds = Helpers.CreateBounds(new Vector3(0, 0, 0), new Vector3(1, 2, 1));
+            mesh.bounds = bounds;
 
             MeshCollider meshCollider = go.AddComponent<MeshCollider>();
             meshCollider.sharedMesh = mesh;
@@ -155,6 +171,20 @@ namespace CesiumForUnity
             }
             meshRenderer.material.shaderKeywords = meshRenderer.material.shaderKeywords;
             meshRenderer.sharedMaterial = meshRenderer.sharedMaterial;
+            Material[] sharedMaterials = meshRenderer.sharedMaterials;
+            meshRenderer.sharedMaterials = sharedMaterials;
+
+            MaterialPropertyBlock propertyBlock = new MaterialPropertyBlock();
+            propertyBlock.Clear();
+            propertyBlock.SetTexture(id, texture2D);
+            propertyBlock.SetFloat(id, 1.0f);
+            propertyBlock.SetVector(id, new Vector4());
+            meshRenderer.SetPropertyBlock(propertyBlock, 0);
+
+            RenderPipelineAsset renderPipeline = GraphicsSettings.currentRenderPipeline;
+            Texture textureForInstanceID = texture2D;
+            int textureInstanceID = textureForInstanceID.GetInstanceID();
+
             meshRenderer.material.shader = meshRenderer.material.shader;
             UnityEngine.Object.Destroy(meshGameObject);
             UnityEngine.Object.DestroyImmediate(meshGameObject);
@@ -217,12 +247,7 @@ namespace CesiumForUnity
             request.downloadHandler = new NativeDownloadHandler();
             request.SetRequestHeader("name", "value");
             request.GetResponseHeader("name");
-            Dictionary<string,string>.Enumerator enumerator = request.GetResponseHeaders().GetEnumerator();
-            while(enumerator.MoveNext())
-            {
-                string key = enumerator.Current.Key;
-                string value = enumerator.Current.Value;
-            }
+            new NativeDownloadHandler().TransferResponseHeaders(request);
             request.downloadHandler.Dispose();
             long responseCode = request.responseCode;
             UnityWebRequestAsyncOperation op = request.SendWebRequest();
@@ -247,6 +272,9 @@ namespace CesiumForUnity
             tileset.preloadSiblings = tileset.preloadSiblings;
             tileset.forbidHoles = tileset.forbidHoles;
             tileset.maximumSimultaneousTileLoads = tileset.maximumSimultaneousTileLoads;
+            tileset.mainThreadLoadingTimeLimit = tileset.mainThreadLoadingTimeLimit;
+            tileset.tileCacheUnloadTimeLimit = tileset.tileCacheUnloadTimeLimit;
+            tileset.prefetchLookAheadTime = tileset.prefetchLookAheadTime;
             tileset.maximumCachedBytes = tileset.maximumCachedBytes;
             tileset.loadingDescendantLimit = tileset.loadingDescendantLimit;
             tileset.enableFrustumCulling = tileset.enableFrustumCulling;
@@ -257,6 +285,11 @@ namespace CesiumForUnity
             //tileset.lodTransitionLength = tileset.lodTransitionLength;
             // tileset.generateSmoothNormals = tileset.generateSmoothNormals;
             tileset.createPhysicsMeshes = tileset.createPhysicsMeshes;
+            tileset.combinePrimitives = tileset.combinePrimitives;
+            tileset.normalFormat = tileset.normalFormat;
+            tileset.texCoordFormat = tileset.texCoordFormat;
+            tileset.quantizePositions = tileset.quantizePositions;
+            tileset.compressTextures = tileset.compressTextures;
             tileset.suspendUpdate = tileset.suspendUpdate;
             tileset.previousSuspendUpdate = tileset.previousSuspendUpdate;
             tileset.showTilesInHierarchy = tileset.showTilesInHierarchy;
@@ -390,6 +423,7 @@ namespace CesiumForUnity
             meshDataArray.Dispose();
 
             Mesh.ApplyAndDisposeWritableMeshData(meshDataArray, meshes, MeshUpdateFlags.Default);
+            Mesh.ApplyAndDisposeWritableMeshData(meshDataArray, mesh, MeshUpdateFlags.Default);
 
             Physics.BakeMesh(mesh.GetInstanceID(), false);
 
@@ -415,6 +449,21 @@ namespace CesiumForUnity
             string.IsNullOrEmpty("value");
 
             string token = CesiumRuntimeSettings.defaultIonAccessToken;
+            int maximumPooledTextures = CesiumRuntimeSettings.maximumPooledTextures;
+            maximumPooledTextures = CesiumRuntimeSettings.maximumPooledTexturesPerSize;
+            CesiumTaskProcessorType taskProcessorType = CesiumRuntimeSettings.taskProcessorType;
+            int threadCount = CesiumRuntimeSettings.nativeThreadPoolThreadCount;
+            long affinityMask = CesiumRuntimeSettings.nativeThreadPoolAffinityMask;
+            CesiumAssetAccessorType assetAccessorType = CesiumRuntimeSettings.assetAccessorType;
+            int maximumRequests = CesiumRuntimeSettings.nativeHttpMaximumConcurrentRequests;
+            maximumRequests = CesiumRuntimeSettings.nativeHttpMaximumConnectionsPerHost;
+            string requestCachePath = CesiumRuntimeSettings.requestCachePath;
+            int requestCacheItems = CesiumRuntimeSettings.requestCacheMaximumItems;
+            requestCacheItems = CesiumRuntimeSettings.requestCacheRequestsPerPrune;
+            bool staleWhileRevalidate = CesiumRuntimeSettings.requestCacheStaleWhileRevalidate;
+            int maximumStaleness = CesiumRuntimeSettings.requestCacheMaximumStaleness;
+            string tilePackPath = CesiumRuntimeSettings.tilePackPath;
+            taskProcessorType = CesiumTaskProcessorType.PriorityThreadPool;
 
             Cesium3DTilesetLoadFailureDetails tilesetDetails
                 = new Cesium3DTilesetLoadFailureDetails(tileset, Cesium3DTilesetLoadType.Unknown, 0, "");
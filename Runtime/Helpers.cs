@@ -11,6 +11,11 @@ namespace CesiumForUnity
             return value.ToString();
         }
 
+        public static Bounds CreateBounds(Vector3 center, Vector3 size)
+        {
+            return new Bounds(center, size);
+        }
+
         public static Vector3 FromMathematics(double3 vector)
         {
             return new Vector3((float)vector.x, (float)vector.y, (float)vector.z);
@@ -1,5 +1,7 @@
 using Reinterop;
 using System;
+using System.Collections.Generic;
+using System.Text;
 using UnityEngine.Networking;
 
 namespace CesiumForUnity
@@ -13,6 +15,11 @@ namespace CesiumForUnity
             CreateImplementation();
         }
 
+        protected override void ReceiveContentLengthHeader(ulong contentLength)
+        {
+            this.ReceiveContentLengthHeaderNative(contentLength);
+        }
+
         protected override bool ReceiveData(byte[] data, int dataLength) {
             unsafe
             {
@@ -24,6 +31,40 @@ namespace CesiumForUnity
             }
         }
 
+        /// <summary>
+        /// Passes all of the response headers of a completed request to native code in a
+        /// single call, as one UTF-8 buffer of null-terminated names and values, so that native
+        /// code doesn't need to cross into managed code for every header.
+        /// </summary>
+        internal void TransferResponseHeaders(UnityWebRequest request)
+        {
+            Dictionary<string, string> headers = request.GetResponseHeaders();
+            if (headers == null || headers.Count == 0)
+            {
+                this.ReceiveResponseHeadersNative(IntPtr.Zero, 0);
+                return;
+            }
+
+            StringBuilder builder = new StringBuilder();
+            foreach (KeyValuePair<string, string> header in headers)
+            {
+                builder.Append(header.Key).Append('\0').Append(header.Value).Append('\0');
+            }
+
+            byte[] bytes = Encoding.UTF8.GetBytes(builder.ToString());
+            unsafe
+            {
+                fixed (byte* p = bytes)
+                {
+                    this.ReceiveResponseHeadersNative((IntPtr)p, bytes.Length);
+                }
+            }
+        }
+
+        private partial void ReceiveResponseHeadersNative(IntPtr data, int dataLength);
+
+        private partial void ReceiveContentLengthHeaderNative(ulong contentLength);
+
         private partial bool ReceiveDataNative(IntPtr data, int dataLength);
     }
 }
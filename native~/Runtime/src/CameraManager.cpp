@@ -7,6 +7,7 @@
 #include <CesiumGeospatial/GlobeTransforms.h>
 #include <CesiumUtility/Math.h>
 
+#include <DotNet/CesiumForUnity/CesiumCameraManager.h>
 #include <DotNet/CesiumForUnity/CesiumGeoreference.h>
 #include <DotNet/UnityEngine/Camera.h>
 #include <DotNet/UnityEngine/GameObject.h>
@@ -15,6 +16,8 @@
 #include <DotNet/UnityEngine/Vector3.h>
 #include <glm/trigonometric.hpp>
 
+#include <unordered_set>
+
 #if UNITY_EDITOR
 #include <DotNet/UnityEditor/EditorApplication.h>
 #include <DotNet/UnityEditor/SceneView.h>
@@ -37,7 +40,8 @@ namespace {
 ViewState unityCameraToViewState(
     const LocalHorizontalCoordinateSystem* pCoordinateSystem,
     const glm::dmat4& unityWorldToTileset,
-    Camera& camera) {
+    Camera& camera,
+    double screenSpaceErrorScale) {
   Transform transform = camera.transform();
 
   Vector3 cameraPositionUnity = transform.position();
@@ -71,11 +75,22 @@ ViewState unityCameraToViewState(
   double horizontalFOV =
       2 * glm::atan(camera.aspect() * glm::tan(verticalFOV * 0.5));
 
+  // Screen-space error is proportional to the viewport height, so scaling the
+  // viewport scales the error of every tile seen by this camera. Culling
+  // only depends on the field of view, so it is unaffected. The scale is
+  // validated by CesiumCameraManager, but a viewport that isn't positive would
+  // break the error computation, so clamp it here too.
+  const double minimumScale = 1e-3;
+  if (!(screenSpaceErrorScale >= minimumScale)) {
+    screenSpaceErrorScale = minimumScale;
+  }
+
   return ViewState::create(
       cameraPosition,
       cameraDirection,
       cameraUp,
-      glm::dvec2(camera.pixelWidth(), camera.pixelHeight()),
+      glm::dvec2(camera.pixelWidth(), camera.pixelHeight()) *
+          screenSpaceErrorScale,
       horizontalFOV,
       verticalFOV);
 }
@@ -98,10 +113,33 @@ std::vector<ViewState> CameraManager::getAllCameras(const GameObject& context) {
   }
 
   std::vector<ViewState> result;
+
+  // Cameras registered with CesiumCameraManager, which may include the main
+  // camera with a non-default screen-space error scale.
+  std::unordered_set<int32_t> cameraIDs;
+  for (int32_t i = 0, len = CesiumCameraManager::GetCameraCount(); i < len;
+       ++i) {
+    Camera camera = CesiumCameraManager::GetCamera(i);
+    if (camera == nullptr || !camera.isActiveAndEnabled() ||
+        !cameraIDs.insert(camera.GetInstanceID()).second) {
+      continue;
+    }
+
+    result.emplace_back(unityCameraToViewState(
+        pCoordinateSystem,
+        unityWorldToTileset,
+        camera,
+        CesiumCameraManager::GetScreenSpaceErrorScale(i)));
+  }
+
   Camera camera = Camera::main();
-  if (camera != nullptr) {
-    result.emplace_back(
-        unityCameraToViewState(pCoordinateSystem, unityWorldToTileset, camera));
+  if (camera != nullptr &&
+      cameraIDs.find(camera.GetInstanceID()) == cameraIDs.end()) {
+    result.emplace_back(unityCameraToViewState(
+        pCoordinateSystem,
+        unityWorldToTileset,
+        camera,
+        1.0));
   }
 
 #if UNITY_EDITOR
@@ -113,7 +151,8 @@ std::vector<ViewState> CameraManager::getAllCameras(const GameObject& context) {
         result.emplace_back(unityCameraToViewState(
             pCoordinateSystem,
             unityWorldToTileset,
-            editorCamera));
+            editorCamera,
+            1.0));
       }
     }
   }
@@ -12,6 +12,11 @@ namespace CesiumForUnityNative {
 
 class CameraManager {
 public:
+  /**
+   * @brief Gets the views that tiles should be selected for: the main camera,
+   * the cameras registered with CesiumCameraManager, and, in the Editor when
+   * not playing, the last active scene view.
+   */
   static std::vector<Cesium3DTilesSelection::ViewState>
   getAllCameras(const DotNet::UnityEngine::GameObject& context);
 };
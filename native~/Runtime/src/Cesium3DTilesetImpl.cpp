@@ -1,12 +1,17 @@
 #include "Cesium3DTilesetImpl.h"
 
 #include "CameraManager.h"
+#include "MeshDataArrayPool.h"
+#include "PriorityTaskProcessor.h"
+#include "TextureLoader.h"
+#include "TexturePool.h"
 #include "UnityPrepareRendererResources.h"
 #include "UnityTilesetExternals.h"
 
 #include <Cesium3DTilesSelection/IonRasterOverlay.h>
 #include <Cesium3DTilesSelection/Tileset.h>
 #include <CesiumGeospatial/GlobeTransforms.h>
+#include <CesiumGltf/Ktx2TranscodeTargets.h>
 
 #include <DotNet/CesiumForUnity/Cesium3DTileset.h>
 #include <DotNet/CesiumForUnity/Cesium3DTilesetLoadFailureDetails.h>
@@ -27,6 +32,7 @@
 #include <DotNet/UnityEngine/Transform.h>
 #include <DotNet/UnityEngine/Vector3.h>
 
+#include <unordered_set>
 #include <variant>
 
 #if UNITY_EDITOR
@@ -48,10 +54,67 @@ Cesium3DTilesetImpl::Cesium3DTilesetImpl(
       _updateInEditorCallback(nullptr),
 #endif
       _creditSystem(nullptr),
-      _destroyTilesetOnNextUpdate(false) {
+      _destroyTilesetOnNextUpdate(false),
+      _tileActivationCount(0),
+      _prefetcher(),
+      _loadPriority(TaskPriority::Medium),
+      _finalizationBacklogged(false),
+      _tilesKeptActive() {
 }
 
-Cesium3DTilesetImpl::~Cesium3DTilesetImpl() {}
+Cesium3DTilesetImpl::~Cesium3DTilesetImpl() {
+  this->setFinalizationBacklogged(false);
+  PriorityTaskProcessor::DrainScope drainScope(getPriorityTaskProcessor());
+  this->_pTileset.reset();
+}
+
+namespace {
+
+CesiumGltfGameObject* getTileGameObject(const Tile& tile) {
+  if (tile.getState() != TileLoadState::Done) {
+    return nullptr;
+  }
+
+  const TileRenderContent* pRenderContent =
+      tile.getContent().getRenderContent();
+  if (!pRenderContent) {
+    return nullptr;
+  }
+
+  CesiumGltfGameObject* pCesiumGameObject =
+      static_cast<CesiumGltfGameObject*>(pRenderContent->getRenderResources());
+  if (!pCesiumGameObject || !pCesiumGameObject->pGameObject) {
+    return nullptr;
+  }
+
+  return pCesiumGameObject;
+}
+
+bool isTilePending(const Tile& tile) {
+  const CesiumGltfGameObject* pCesiumGameObject = getTileGameObject(tile);
+  return pCesiumGameObject && pCesiumGameObject->pending;
+}
+
+/**
+ * @brief Activates or deactivates the game object of a tile, unless it is
+ * already in that state. Tiles whose meshes are still being finalized are
+ * left inactive.
+ *
+ * @returns true if SetActive was called.
+ */
+bool setTileActive(Tile& tile, bool active) {
+  CesiumGltfGameObject* pCesiumGameObject = getTileGameObject(tile);
+  if (!pCesiumGameObject || pCesiumGameObject->pending ||
+      pCesiumGameObject->active == active) {
+    return false;
+  }
+
+  pCesiumGameObject->pGameObject->SetActive(active);
+  pCesiumGameObject->active = active;
+  return true;
+}
+
+} // namespace
 
 void Cesium3DTilesetImpl::Start(
     const DotNet::CesiumForUnity::Cesium3DTileset& tileset) {}
@@ -85,49 +148,114 @@ void Cesium3DTilesetImpl::Update(
       return;
   }
 
+  // Top up the mesh data that worker threads take from while loading tiles.
+  MeshDataArrayPool::refill();
+
+  UnityPrepareRendererResources& prepareRendererResources =
+      static_cast<UnityPrepareRendererResources&>(
+          *this->_pTileset->getExternals().pPrepareRendererResources);
+
+  // Read the tileset settings once, rather than for every tile or primitive.
+  prepareRendererResources.updateRenderState(tileset, this->_pTileset.get());
+
   std::vector<ViewState> viewStates =
       CameraManager::getAllCameras(tileset.gameObject());
 
-  const ViewUpdateResult& updateResult = this->_pTileset->updateView(
-      viewStates,
-      DotNet::UnityEngine::Time::deltaTime());
+  const float deltaTime = DotNet::UnityEngine::Time::deltaTime();
+  const float prefetchLookAheadTime = tileset.prefetchLookAheadTime();
+
+  // Views predicted from camera motion only take part in tile selection.
+  std::vector<ViewState> selectionViewStates =
+      prefetchLookAheadTime > 0.0f ? this->_prefetcher.addPredictedViews(
+                                         viewStates,
+                                         deltaTime,
+                                         prefetchLookAheadTime)
+                                   : viewStates;
+
+  // Worker tasks started while updating the view, and all of their
+  // continuations, share the priority of the most urgent tiles this tileset
+  // was loading in the previous frame.
+  const ViewUpdateResult* pUpdateResult;
+  {
+    PriorityTaskProcessor::Scope priorityScope(this->_loadPriority);
+    pUpdateResult =
+        &this->_pTileset->updateView(selectionViewStates, deltaTime);
+  }
+
+  const ViewUpdateResult& updateResult = *pUpdateResult;
   this->updateLastViewUpdateResultState(tileset, updateResult);
 
-  for (auto pTile : updateResult.tilesFadingOut) {
-    if (pTile->getState() != TileLoadState::Done) {
+  if (updateResult.tilesLoadingHighPriority > 0) {
+    this->_loadPriority = TaskPriority::High;
+  } else if (updateResult.tilesLoadingMediumPriority > 0) {
+    this->_loadPriority = TaskPriority::Medium;
+  } else if (updateResult.tilesLoadingLowPriority > 0) {
+    this->_loadPriority = TaskPriority::Low;
+  } else {
+    // A tileset with nothing loading starts its next loads in the medium
+    // lane, so that it isn't starved behind busier tilesets while the low
+    // lane is paused.
+    this->_loadPriority = TaskPriority::Medium;
+  }
+
+  if (prefetchLookAheadTime > 0.0f) {
+    this->_prefetcher.updateStatistics(viewStates, updateResult);
+  } else {
+    this->_prefetcher.reset();
+  }
+
+  // Tiles loaded by updateView only get their game objects here, spread
+  // across frames according to the main thread time limit. Only the real
+  // views are used to prioritize them, so prefetched tiles come last.
+  prepareRendererResources.finalizeTiles(
+      viewStates,
+      tileset.mainThreadLoadingTimeLimit());
+  this->setFinalizationBacklogged(
+      prepareRendererResources.getPendingTileCount() > 0);
+
+  // cesium-native considers a tile renderable as soon as it is prepared in
+  // the main thread, but its game object stays inactive until all of its
+  // meshes are finalized. Keep the tiles it replaced visible until then, so
+  // that refining doesn't leave holes.
+  std::unordered_set<const Tile*> ancestorsOfPendingTiles;
+  for (const Tile* pTile : updateResult.tilesToRenderThisFrame) {
+    if (!isTilePending(*pTile)) {
       continue;
     }
-
-    const Cesium3DTilesSelection::TileContent& content = pTile->getContent();
-    const Cesium3DTilesSelection::TileRenderContent* pRenderContent =
-        content.getRenderContent();
-    if (pRenderContent) {
-      CesiumGltfGameObject* pCesiumGameObject =
-          static_cast<CesiumGltfGameObject*>(
-              pRenderContent->getRenderResources());
-      if (pCesiumGameObject && pCesiumGameObject->pGameObject) {
-        pCesiumGameObject->pGameObject->SetActive(false);
+    for (const Tile* pParent = pTile->getParent(); pParent;
+         pParent = pParent->getParent()) {
+      if (!ancestorsOfPendingTiles.insert(pParent).second) {
+        break;
       }
     }
   }
 
-  for (auto pTile : updateResult.tilesToRenderThisFrame) {
-    if (pTile->getState() != TileLoadState::Done) {
-      continue;
+  // Only tiles whose visibility changed since the last update cross into
+  // managed code, so a frame with a still camera costs almost nothing here.
+  int32_t activationCount = 0;
+  std::unordered_set<Tile*> tilesKeptActive;
+  auto deactivateTile = [&](Tile* pTile) {
+    if (ancestorsOfPendingTiles.count(pTile) > 0) {
+      tilesKeptActive.insert(pTile);
+    } else if (setTileActive(*pTile, false)) {
+      ++activationCount;
     }
+  };
 
-    const Cesium3DTilesSelection::TileContent& content = pTile->getContent();
-    const Cesium3DTilesSelection::TileRenderContent* pRenderContent =
-        content.getRenderContent();
-    if (pRenderContent) {
-      CesiumGltfGameObject* pCesiumGameObject =
-          static_cast<CesiumGltfGameObject*>(
-              pRenderContent->getRenderResources());
-      if (pCesiumGameObject && pCesiumGameObject->pGameObject) {
-        pCesiumGameObject->pGameObject->SetActive(true);
-      }
+  for (Tile* pTile : updateResult.tilesFadingOut) {
+    deactivateTile(pTile);
+  }
+  for (Tile* pTile : this->_tilesKeptActive) {
+    deactivateTile(pTile);
+  }
+  this->_tilesKeptActive = std::move(tilesKeptActive);
+
+  for (Tile* pTile : updateResult.tilesToRenderThisFrame) {
+    if (setTileActive(*pTile, true)) {
+      ++activationCount;
     }
   }
+  this->_tileActivationCount = activationCount;
 }
 
 void Cesium3DTilesetImpl::OnValidate(
@@ -146,6 +274,9 @@ void Cesium3DTilesetImpl::OnValidate(
 
 void Cesium3DTilesetImpl::OnEnable(
     const DotNet::CesiumForUnity::Cesium3DTileset& tileset) {
+  MeshDataArrayPool::addUser();
+  TexturePool::addUser();
+
 #if UNITY_EDITOR
   // In the Editor, Update will only be called when something
   // changes. We need to call it continuously to allow tiles to
@@ -175,6 +306,9 @@ void Cesium3DTilesetImpl::OnDisable(
   this->_creditSystem = nullptr;
 
   this->DestroyTileset(tileset);
+
+  MeshDataArrayPool::removeUser();
+  TexturePool::removeUser();
 }
 
 void Cesium3DTilesetImpl::RecreateTileset(
@@ -236,6 +370,21 @@ struct CalculateECEFCameraPosition {
 };
 } // namespace
 
+int32_t Cesium3DTilesetImpl::GetTileActivationCount(
+    const DotNet::CesiumForUnity::Cesium3DTileset& tileset) {
+  return this->_tileActivationCount;
+}
+
+int64_t Cesium3DTilesetImpl::GetPrefetchHitCount(
+    const DotNet::CesiumForUnity::Cesium3DTileset& tileset) {
+  return this->_prefetcher.getHitCount();
+}
+
+int64_t Cesium3DTilesetImpl::GetPrefetchWasteCount(
+    const DotNet::CesiumForUnity::Cesium3DTileset& tileset) {
+  return this->_prefetcher.getWasteCount();
+}
+
 void Cesium3DTilesetImpl::FocusTileset(
     const DotNet::CesiumForUnity::Cesium3DTileset& tileset) {
 
@@ -313,6 +462,19 @@ void Cesium3DTilesetImpl::setCreditSystem(
   this->_creditSystem = creditSystem;
 }
 
+void Cesium3DTilesetImpl::setFinalizationBacklogged(bool backlogged) {
+  if (backlogged == this->_finalizationBacklogged) {
+    return;
+  }
+
+  this->_finalizationBacklogged = backlogged;
+
+  PriorityTaskProcessor* pTaskProcessor = getPriorityTaskProcessor();
+  if (pTaskProcessor) {
+    pTaskProcessor->setTilesetBacklogged(backlogged);
+  }
+}
+
 void Cesium3DTilesetImpl::updateLastViewUpdateResultState(
     const DotNet::CesiumForUnity::Cesium3DTileset& tileset,
     const Cesium3DTilesSelection::ViewUpdateResult& currentResult) {
@@ -361,7 +523,17 @@ void Cesium3DTilesetImpl::DestroyTileset(
     overlay.RemoveFromTileset();
   }
 
-  this->_pTileset.reset();
+  // The tileset's destructor waits for its loads to finish. Some of them may
+  // be waiting in the low lane of the task processor, which stays paused for
+  // as long as any tileset is backlogged, so run it until the tileset is gone.
+  this->setFinalizationBacklogged(false);
+  {
+    PriorityTaskProcessor::DrainScope drainScope(getPriorityTaskProcessor());
+    this->_tilesKeptActive.clear();
+    this->_pTileset.reset();
+  }
+  this->_prefetcher.reset();
+  this->_loadPriority = TaskPriority::Medium;
 }
 
 void Cesium3DTilesetImpl::LoadTileset(
@@ -395,16 +567,25 @@ void Cesium3DTilesetImpl::LoadTileset(
             unityDetails);
       };
 
-  // Generous per-frame time limits for loading / unloading on main thread.
-  options.mainThreadLoadingTimeLimit = 5.0;
-  options.tileCacheUnloadTimeLimit = 5.0;
+  options.mainThreadLoadingTimeLimit = tileset.mainThreadLoadingTimeLimit();
+  options.tileCacheUnloadTimeLimit = tileset.tileCacheUnloadTimeLimit();
 
   TilesetContentOptions contentOptions{};
   contentOptions.generateMissingNormalsSmooth = true;
   // .. = tileset.generateSmoothNormals();
 
+  // Transcode KTX2 textures to the best block-compressed format this device
+  // supports, such as BC7 on desktop or ASTC and ETC2 on mobile.
+  contentOptions.ktx2TranscodeTargets = CesiumGltf::Ktx2TranscodeTargets(
+      TextureLoader::getSupportedGpuCompressedPixelFormats(),
+      false);
+
   options.contentOptions = contentOptions;
 
+  TexturePool::setLimits(
+      CesiumForUnity::CesiumRuntimeSettings::maximumPooledTextures(),
+      CesiumForUnity::CesiumRuntimeSettings::maximumPooledTexturesPerSize());
+
   this->_lastUpdateResult = ViewUpdateResult();
 
   if (tileset.tilesetSource() ==
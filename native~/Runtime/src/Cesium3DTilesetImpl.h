@@ -1,5 +1,8 @@
 #pragma once
 
+#include "PriorityTaskProcessor.h"
+#include "TilePrefetcher.h"
+
 #include <Cesium3DTilesSelection/ViewUpdateResult.h>
 
 #include <DotNet/CesiumForUnity/CesiumCreditSystem.h>
@@ -7,6 +10,7 @@
 #include <DotNet/System/Action.h>
 
 #include <memory>
+#include <unordered_set>
 
 #if UNITY_EDITOR
 #include <DotNet/UnityEditor/CallbackFunction.h>
@@ -36,6 +40,12 @@ public:
 
   void RecreateTileset(const DotNet::CesiumForUnity::Cesium3DTileset& tileset);
   void FocusTileset(const DotNet::CesiumForUnity::Cesium3DTileset& tileset);
+  int32_t GetTileActivationCount(
+      const DotNet::CesiumForUnity::Cesium3DTileset& tileset);
+  int64_t GetPrefetchHitCount(
+      const DotNet::CesiumForUnity::Cesium3DTileset& tileset);
+  int64_t GetPrefetchWasteCount(
+      const DotNet::CesiumForUnity::Cesium3DTileset& tileset);
 
   Cesium3DTilesSelection::Tileset* getTileset();
   const Cesium3DTilesSelection::Tileset* getTileset() const;
@@ -47,6 +57,7 @@ public:
 private:
   void DestroyTileset(const DotNet::CesiumForUnity::Cesium3DTileset& tileset);
   void LoadTileset(const DotNet::CesiumForUnity::Cesium3DTileset& tileset);
+  void setFinalizationBacklogged(bool backlogged);
   void updateLastViewUpdateResultState(
       const DotNet::CesiumForUnity::Cesium3DTileset& tileset,
       const Cesium3DTilesSelection::ViewUpdateResult& currentResult);
@@ -58,6 +69,16 @@ private:
 #endif
   DotNet::CesiumForUnity::CesiumCreditSystem _creditSystem;
   bool _destroyTilesetOnNextUpdate;
+  int32_t _tileActivationCount;
+  TilePrefetcher _prefetcher;
+  TaskPriority _loadPriority;
+  bool _finalizationBacklogged;
+
+  /**
+   * @brief Tiles that are no longer rendered, but whose game objects are kept
+   * active because tiles that replace them are still being finalized.
+   */
+  std::unordered_set<Cesium3DTilesSelection::Tile*> _tilesKeptActive;
 };
 
 } // namespace CesiumForUnityNative
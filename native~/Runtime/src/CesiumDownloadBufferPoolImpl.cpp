@@ -0,0 +1,31 @@
+#include "CesiumDownloadBufferPoolImpl.h"
+
+#include "DownloadBufferPool.h"
+
+namespace CesiumForUnityNative {
+
+int64_t CesiumDownloadBufferPoolImpl::GetResponseCount() {
+  return DownloadBufferPool::getResponseCount();
+}
+
+int64_t CesiumDownloadBufferPoolImpl::GetBytesReceived() {
+  return DownloadBufferPool::getBytesReceived();
+}
+
+int64_t CesiumDownloadBufferPoolImpl::GetBytesCopied() {
+  return DownloadBufferPool::getBytesCopied();
+}
+
+int64_t CesiumDownloadBufferPoolImpl::GetReallocationCount() {
+  return DownloadBufferPool::getReallocationCount();
+}
+
+int32_t CesiumDownloadBufferPoolImpl::GetPooledBufferCount() {
+  return DownloadBufferPool::getPooledBufferCount();
+}
+
+void CesiumDownloadBufferPoolImpl::ResetStatistics() {
+  DownloadBufferPool::resetStatistics();
+}
+
+} // namespace CesiumForUnityNative
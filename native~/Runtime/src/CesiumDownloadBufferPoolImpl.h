@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DotNet::CesiumForUnity {
+class CesiumDownloadBufferPool;
+}
+
+namespace CesiumForUnityNative {
+
+class CesiumDownloadBufferPoolImpl {
+public:
+  static int64_t GetResponseCount();
+  static int64_t GetBytesReceived();
+  static int64_t GetBytesCopied();
+  static int64_t GetReallocationCount();
+  static int32_t GetPooledBufferCount();
+  static void ResetStatistics();
+};
+
+} // namespace CesiumForUnityNative
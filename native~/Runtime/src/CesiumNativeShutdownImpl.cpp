@@ -0,0 +1,9 @@
+#include "CesiumNativeShutdownImpl.h"
+
+#include "UnityTilesetExternals.h"
+
+namespace CesiumForUnityNative {
+
+void CesiumNativeShutdownImpl::Shutdown() { shutdownTilesetExternals(); }
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace DotNet::CesiumForUnity {
+class CesiumNativeShutdown;
+}
+
+namespace CesiumForUnityNative {
+
+class CesiumNativeShutdownImpl {
+public:
+  static void Shutdown();
+};
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,93 @@
+#include "CesiumRequestStatisticsImpl.h"
+
+#include "CountingCacheDatabase.h"
+#include "DeduplicatingAssetAccessor.h"
+#include "StaleWhileRevalidateAssetAccessor.h"
+#include "UnityTilesetExternals.h"
+
+namespace CesiumForUnityNative {
+
+int64_t CesiumRequestStatisticsImpl::GetIssuedRequestCount() {
+  DeduplicatingAssetAccessor* pAccessor = getDeduplicatingAssetAccessor();
+  return pAccessor ? pAccessor->getIssuedRequestCount() : 0;
+}
+
+int64_t CesiumRequestStatisticsImpl::GetCoalescedRequestCount() {
+  DeduplicatingAssetAccessor* pAccessor = getDeduplicatingAssetAccessor();
+  return pAccessor ? pAccessor->getCoalescedRequestCount() : 0;
+}
+
+int32_t CesiumRequestStatisticsImpl::GetInFlightRequestCount() {
+  DeduplicatingAssetAccessor* pAccessor = getDeduplicatingAssetAccessor();
+  return pAccessor ? pAccessor->getInFlightRequestCount() : 0;
+}
+
+int64_t CesiumRequestStatisticsImpl::GetCacheHitCount() {
+  int64_t result = 0;
+
+  CountingCacheDatabase* pDatabase = getCacheDatabase();
+  if (pDatabase) {
+    result += pDatabase->getHitCount();
+  }
+
+  // Hits served by stale-while-revalidate never reach the counted database.
+  StaleWhileRevalidateAssetAccessor* pAccessor =
+      getStaleWhileRevalidateAssetAccessor();
+  if (pAccessor) {
+    result += pAccessor->getFreshHitCount() + pAccessor->getStaleHitCount();
+  }
+
+  return result;
+}
+
+int64_t CesiumRequestStatisticsImpl::GetCacheExpiredCount() {
+  CountingCacheDatabase* pDatabase = getCacheDatabase();
+  return pDatabase ? pDatabase->getExpiredCount() : 0;
+}
+
+int64_t CesiumRequestStatisticsImpl::GetCacheMissCount() {
+  CountingCacheDatabase* pDatabase = getCacheDatabase();
+  return pDatabase ? pDatabase->getMissCount() : 0;
+}
+
+int64_t CesiumRequestStatisticsImpl::GetCacheStoreCount() {
+  CountingCacheDatabase* pDatabase = getCacheDatabase();
+  return pDatabase ? pDatabase->getStoreCount() : 0;
+}
+
+int64_t CesiumRequestStatisticsImpl::GetCachePruneCount() {
+  CountingCacheDatabase* pDatabase = getCacheDatabase();
+  return pDatabase ? pDatabase->getPruneCount() : 0;
+}
+
+int64_t CesiumRequestStatisticsImpl::GetCacheStaleHitCount() {
+  StaleWhileRevalidateAssetAccessor* pAccessor =
+      getStaleWhileRevalidateAssetAccessor();
+  return pAccessor ? pAccessor->getStaleHitCount() : 0;
+}
+
+int64_t CesiumRequestStatisticsImpl::GetCacheRevalidationCount() {
+  StaleWhileRevalidateAssetAccessor* pAccessor =
+      getStaleWhileRevalidateAssetAccessor();
+  return pAccessor ? pAccessor->getRevalidationCount() : 0;
+}
+
+void CesiumRequestStatisticsImpl::ResetStatistics() {
+  DeduplicatingAssetAccessor* pAccessor = getDeduplicatingAssetAccessor();
+  if (pAccessor) {
+    pAccessor->resetStatistics();
+  }
+
+  CountingCacheDatabase* pDatabase = getCacheDatabase();
+  if (pDatabase) {
+    pDatabase->resetStatistics();
+  }
+
+  StaleWhileRevalidateAssetAccessor* pStaleWhileRevalidateAccessor =
+      getStaleWhileRevalidateAssetAccessor();
+  if (pStaleWhileRevalidateAccessor) {
+    pStaleWhileRevalidateAccessor->resetStatistics();
+  }
+}
+
+} // namespace CesiumForUnityNative
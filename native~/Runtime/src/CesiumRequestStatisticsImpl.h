@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DotNet::CesiumForUnity {
+class CesiumRequestStatistics;
+}
+
+namespace CesiumForUnityNative {
+
+class CesiumRequestStatisticsImpl {
+public:
+  static int64_t GetIssuedRequestCount();
+  static int64_t GetCoalescedRequestCount();
+  static int32_t GetInFlightRequestCount();
+  static int64_t GetCacheHitCount();
+  static int64_t GetCacheExpiredCount();
+  static int64_t GetCacheMissCount();
+  static int64_t GetCacheStoreCount();
+  static int64_t GetCachePruneCount();
+  static int64_t GetCacheStaleHitCount();
+  static int64_t GetCacheRevalidationCount();
+  static void ResetStatistics();
+};
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,19 @@
+#include "CesiumTaskProcessorImpl.h"
+
+#include "PriorityTaskProcessor.h"
+#include "UnityTilesetExternals.h"
+
+namespace CesiumForUnityNative {
+
+int32_t CesiumTaskProcessorImpl::GetQueuedTaskCount(
+    DotNet::CesiumForUnity::CesiumTaskPriority priority) {
+  PriorityTaskProcessor* pTaskProcessor = getPriorityTaskProcessor();
+  if (!pTaskProcessor) {
+    return 0;
+  }
+
+  return pTaskProcessor->getQueuedTaskCount(
+      static_cast<TaskPriority>(priority));
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <DotNet/CesiumForUnity/CesiumTaskPriority.h>
+
+#include <cstdint>
+
+namespace DotNet::CesiumForUnity {
+class CesiumTaskProcessor;
+}
+
+namespace CesiumForUnityNative {
+
+class CesiumTaskProcessorImpl {
+public:
+  static int32_t
+  GetQueuedTaskCount(DotNet::CesiumForUnity::CesiumTaskPriority priority);
+};
+
+} // namespace CesiumForUnityNative
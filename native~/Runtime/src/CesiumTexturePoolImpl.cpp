@@ -0,0 +1,23 @@
+#include "CesiumTexturePoolImpl.h"
+
+#include "TexturePool.h"
+
+namespace CesiumForUnityNative {
+
+int64_t CesiumTexturePoolImpl::GetHitCount() {
+  return TexturePool::getHitCount();
+}
+
+int64_t CesiumTexturePoolImpl::GetMissCount() {
+  return TexturePool::getMissCount();
+}
+
+int32_t CesiumTexturePoolImpl::GetPooledTextureCount() {
+  return TexturePool::getPooledTextureCount();
+}
+
+void CesiumTexturePoolImpl::ResetStatistics() {
+  TexturePool::resetStatistics();
+}
+
+} // namespace CesiumForUnityNative
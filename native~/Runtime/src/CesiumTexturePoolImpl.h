@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DotNet::CesiumForUnity {
+class CesiumTexturePool;
+}
+
+namespace CesiumForUnityNative {
+
+class CesiumTexturePoolImpl {
+public:
+  static int64_t GetHitCount();
+  static int64_t GetMissCount();
+  static int32_t GetPooledTextureCount();
+  static void ResetStatistics();
+};
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,42 @@
+#include "CesiumTilePackImpl.h"
+
+#include "TilePackAssetAccessor.h"
+#include "UnityTilesetExternals.h"
+
+#include <DotNet/System/String.h>
+
+namespace CesiumForUnityNative {
+
+bool CesiumTilePackImpl::StartRecording(const DotNet::System::String& path) {
+  return getTilePackAssetAccessor().startRecording(path.ToStlString());
+}
+
+bool CesiumTilePackImpl::StopRecording() {
+  return getTilePackAssetAccessor().stopRecording();
+}
+
+bool CesiumTilePackImpl::IsRecording() {
+  return getTilePackAssetAccessor().isRecording();
+}
+
+int32_t CesiumTilePackImpl::GetRecordedEntryCount() {
+  return getTilePackAssetAccessor().getRecordedEntryCount();
+}
+
+int32_t CesiumTilePackImpl::GetEntryCount() {
+  return getTilePackAssetAccessor().getEntryCount();
+}
+
+int64_t CesiumTilePackImpl::GetHitCount() {
+  return getTilePackAssetAccessor().getHitCount();
+}
+
+int64_t CesiumTilePackImpl::GetMissCount() {
+  return getTilePackAssetAccessor().getMissCount();
+}
+
+void CesiumTilePackImpl::ResetStatistics() {
+  getTilePackAssetAccessor().resetStatistics();
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DotNet::CesiumForUnity {
+class CesiumTilePack;
+}
+
+namespace DotNet::System {
+class String;
+}
+
+namespace CesiumForUnityNative {
+
+class CesiumTilePackImpl {
+public:
+  static bool StartRecording(const DotNet::System::String& path);
+  static bool StopRecording();
+  static bool IsRecording();
+  static int32_t GetRecordedEntryCount();
+  static int32_t GetEntryCount();
+  static int64_t GetHitCount();
+  static int64_t GetMissCount();
+  static void ResetStatistics();
+};
+
+} // namespace CesiumForUnityNative
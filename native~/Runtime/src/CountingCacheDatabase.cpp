@@ -0,0 +1,137 @@
+#include "CountingCacheDatabase.h"
+
+#include <ctime>
+
+using namespace CesiumAsync;
+
+namespace CesiumForUnityNative {
+
+CountingCacheDatabase::CountingCacheDatabase(
+    const std::shared_ptr<ICacheDatabase>& pDatabase)
+    : _pDatabase(pDatabase),
+      _primedMutex(),
+      _primed(),
+      _hitCount(0),
+      _expiredCount(0),
+      _missCount(0),
+      _storeCount(0),
+      _pruneCount(0) {}
+
+std::optional<CacheItem>
+CountingCacheDatabase::getEntry(const std::string& key) const {
+  std::optional<CacheItem> result;
+  bool wasPrimed = false;
+  {
+    std::lock_guard<std::mutex> lock(this->_primedMutex);
+    auto it = this->_primed.find(key);
+    if (it != this->_primed.end()) {
+      result = std::move(it->second);
+      this->_primed.erase(it);
+      wasPrimed = true;
+    }
+  }
+
+  if (!wasPrimed) {
+    result = this->_pDatabase->getEntry(key);
+  }
+
+  if (result) {
+    // Expired entries are revalidated with the server, and only used if it
+    // says they haven't changed, so they aren't hits.
+    if (result->expiryTime >= std::time(nullptr)) {
+      ++this->_hitCount;
+    } else {
+      ++this->_expiredCount;
+    }
+  } else {
+    ++this->_missCount;
+  }
+  return result;
+}
+
+bool CountingCacheDatabase::storeEntry(
+    const std::string& key,
+    std::time_t expiryTime,
+    const std::string& url,
+    const std::string& requestMethod,
+    const HttpHeaders& requestHeaders,
+    uint16_t statusCode,
+    const HttpHeaders& responseHeaders,
+    const gsl::span<const std::byte>& responseData) {
+  {
+    std::lock_guard<std::mutex> lock(this->_primedMutex);
+    this->_primed.erase(key);
+  }
+
+  const bool stored = this->_pDatabase->storeEntry(
+      key,
+      expiryTime,
+      url,
+      requestMethod,
+      requestHeaders,
+      statusCode,
+      responseHeaders,
+      responseData);
+  if (stored) {
+    ++this->_storeCount;
+  }
+  return stored;
+}
+
+bool CountingCacheDatabase::prune() {
+  const bool pruned = this->_pDatabase->prune();
+  if (pruned) {
+    ++this->_pruneCount;
+  }
+  return pruned;
+}
+
+bool CountingCacheDatabase::clearAll() {
+  {
+    std::lock_guard<std::mutex> lock(this->_primedMutex);
+    this->_primed.clear();
+  }
+  return this->_pDatabase->clearAll();
+}
+
+std::optional<CacheItem>
+CountingCacheDatabase::peekEntry(const std::string& key) const {
+  return this->_pDatabase->getEntry(key);
+}
+
+void CountingCacheDatabase::primeEntry(
+    const std::string& key,
+    std::optional<CacheItem>&& maybeItem) {
+  std::lock_guard<std::mutex> lock(this->_primedMutex);
+  this->_primed.insert_or_assign(key, std::move(maybeItem));
+}
+
+int64_t CountingCacheDatabase::getHitCount() const noexcept {
+  return this->_hitCount;
+}
+
+int64_t CountingCacheDatabase::getExpiredCount() const noexcept {
+  return this->_expiredCount;
+}
+
+int64_t CountingCacheDatabase::getMissCount() const noexcept {
+  return this->_missCount;
+}
+
+int64_t CountingCacheDatabase::getStoreCount() const noexcept {
+  return this->_storeCount;
+}
+
+int64_t CountingCacheDatabase::getPruneCount() const noexcept {
+  return this->_pruneCount;
+}
+
+void CountingCacheDatabase::resetStatistics() noexcept {
+  this->_hitCount = 0;
+  this->_expiredCount = 0;
+  this->_missCount = 0;
+  this->_storeCount = 0;
+  this->_pruneCount = 0;
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <CesiumAsync/CacheItem.h>
+#include <CesiumAsync/ICacheDatabase.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief A cache database that counts lookups, stores, and prunes and passes
+ * them on to another cache database.
+ */
+class CountingCacheDatabase : public CesiumAsync::ICacheDatabase {
+public:
+  CountingCacheDatabase(
+      const std::shared_ptr<CesiumAsync::ICacheDatabase>& pDatabase);
+
+  virtual std::optional<CesiumAsync::CacheItem>
+  getEntry(const std::string& key) const override;
+
+  virtual bool storeEntry(
+      const std::string& key,
+      std::time_t expiryTime,
+      const std::string& url,
+      const std::string& requestMethod,
+      const CesiumAsync::HttpHeaders& requestHeaders,
+      uint16_t statusCode,
+      const CesiumAsync::HttpHeaders& responseHeaders,
+      const gsl::span<const std::byte>& responseData) override;
+
+  virtual bool prune() override;
+
+  virtual bool clearAll() override;
+
+  /**
+   * @brief Looks up an entry without counting the lookup.
+   */
+  std::optional<CesiumAsync::CacheItem> peekEntry(const std::string& key) const;
+
+  /**
+   * @brief Hands the result of a lookup made with {@link peekEntry} to the
+   * next {@link getEntry} for the same key, which returns and counts it
+   * instead of reading the entry from the database again.
+   *
+   * This is for accessors in front of a CachingAssetAccessor that look at an
+   * entry and then pass the request on to it. Storing an entry under the key
+   * discards the result.
+   */
+  void primeEntry(
+      const std::string& key,
+      std::optional<CesiumAsync::CacheItem>&& maybeItem);
+
+  /**
+   * @brief Gets the number of lookups that found an entry that had not
+   * expired.
+   */
+  int64_t getHitCount() const noexcept;
+
+  /**
+   * @brief Gets the number of lookups that found an expired entry, which has
+   * to be revalidated with the server before it can be used.
+   */
+  int64_t getExpiredCount() const noexcept;
+
+  /**
+   * @brief Gets the number of lookups that found no entry.
+   */
+  int64_t getMissCount() const noexcept;
+
+  /**
+   * @brief Gets the number of entries that were stored successfully.
+   */
+  int64_t getStoreCount() const noexcept;
+
+  /**
+   * @brief Gets the number of times the least recently used entries were
+   * evicted to bring the cache back within its maximum number of items.
+   */
+  int64_t getPruneCount() const noexcept;
+
+  void resetStatistics() noexcept;
+
+private:
+  std::shared_ptr<CesiumAsync::ICacheDatabase> _pDatabase;
+
+  mutable std::mutex _primedMutex;
+  mutable std::unordered_map<std::string, std::optional<CesiumAsync::CacheItem>>
+      _primed;
+
+  mutable std::atomic<int64_t> _hitCount;
+  mutable std::atomic<int64_t> _expiredCount;
+  mutable std::atomic<int64_t> _missCount;
+  std::atomic<int64_t> _storeCount;
+  std::atomic<int64_t> _pruneCount;
+};
+
+} // namespace CesiumForUnityNative
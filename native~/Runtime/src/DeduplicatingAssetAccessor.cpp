@@ -0,0 +1,127 @@
+#include "DeduplicatingAssetAccessor.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+
+#include <stdexcept>
+
+using namespace CesiumAsync;
+
+namespace CesiumForUnityNative {
+
+std::string createDeduplicationKey(
+    const std::string& url,
+    const std::vector<IAssetAccessor::THeader>& headers) {
+  size_t size = url.size() + 1;
+  for (const IAssetAccessor::THeader& header : headers) {
+    size += header.first.size() + header.second.size() + 2;
+  }
+
+  // Null characters can't appear in URLs or header fields, so they keep the
+  // parts of the key from running into each other.
+  std::string key;
+  key.reserve(size);
+  key += url;
+  key += '\0';
+  for (const IAssetAccessor::THeader& header : headers) {
+    key += header.first;
+    key += '\0';
+    key += header.second;
+    key += '\0';
+  }
+  return key;
+}
+
+DeduplicatingAssetAccessor::DeduplicatingAssetAccessor(
+    const std::shared_ptr<IAssetAccessor>& pAccessor)
+    : _pAccessor(pAccessor),
+      _inFlightMutex(),
+      _inFlight(),
+      _issuedRequestCount(0),
+      _coalescedRequestCount(0) {}
+
+Future<std::shared_ptr<IAssetRequest>> DeduplicatingAssetAccessor::get(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+  std::string key = createDeduplicationKey(url, headers);
+
+  std::unique_lock<std::mutex> lock(this->_inFlightMutex);
+
+  auto it = this->_inFlight.find(key);
+  if (it != this->_inFlight.end()) {
+    ++this->_coalescedRequestCount;
+    return it->second.thenImmediately(
+        [](const std::shared_ptr<IAssetRequest>& pRequest) {
+          return pRequest;
+        });
+  }
+
+  ++this->_issuedRequestCount;
+
+  Promise<std::shared_ptr<IAssetRequest>> promise =
+      asyncSystem.createPromise<std::shared_ptr<IAssetRequest>>();
+  SharedFuture<std::shared_ptr<IAssetRequest>> sharedFuture =
+      promise.getFuture().share();
+  this->_inFlight.emplace(key, sharedFuture);
+
+  // The wrapped accessor may complete immediately, for example from a cache,
+  // and completing removes the request from the table.
+  lock.unlock();
+
+  std::shared_ptr<DeduplicatingAssetAccessor> pThis =
+      this->shared_from_this();
+  this->_pAccessor->get(asyncSystem, url, headers)
+      .thenImmediately(
+          [pThis, key, promise](std::shared_ptr<IAssetRequest>&& pRequest) {
+            pThis->removeInFlight(key);
+            promise.resolve(std::move(pRequest));
+          })
+      .catchImmediately([pThis, key, promise](std::exception&& e) {
+        pThis->removeInFlight(key);
+        promise.reject(std::runtime_error(e.what()));
+      });
+
+  return sharedFuture.thenImmediately(
+      [](const std::shared_ptr<IAssetRequest>& pRequest) { return pRequest; });
+}
+
+Future<std::shared_ptr<IAssetRequest>> DeduplicatingAssetAccessor::request(
+    const AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const gsl::span<const std::byte>& contentPayload) {
+  if (verb == "GET" && contentPayload.empty()) {
+    return this->get(asyncSystem, url, headers);
+  }
+  return this->_pAccessor
+      ->request(asyncSystem, verb, url, headers, contentPayload);
+}
+
+void DeduplicatingAssetAccessor::tick() noexcept { this->_pAccessor->tick(); }
+
+int64_t DeduplicatingAssetAccessor::getIssuedRequestCount() const noexcept {
+  return this->_issuedRequestCount;
+}
+
+int64_t DeduplicatingAssetAccessor::getCoalescedRequestCount() const noexcept {
+  return this->_coalescedRequestCount;
+}
+
+int32_t DeduplicatingAssetAccessor::getInFlightRequestCount() const {
+  std::lock_guard<std::mutex> lock(this->_inFlightMutex);
+  return int32_t(this->_inFlight.size());
+}
+
+void DeduplicatingAssetAccessor::resetStatistics() noexcept {
+  this->_issuedRequestCount = 0;
+  this->_coalescedRequestCount = 0;
+}
+
+void DeduplicatingAssetAccessor::removeInFlight(const std::string& key) {
+  std::lock_guard<std::mutex> lock(this->_inFlightMutex);
+  this->_inFlight.erase(key);
+}
+
+} // namespace CesiumForUnityNative
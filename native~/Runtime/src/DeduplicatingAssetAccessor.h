@@ -0,0 +1,95 @@
+#pragma once
+
+#include <CesiumAsync/IAssetAccessor.h>
+#include <CesiumAsync/SharedFuture.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief Creates the key that identifies a GET request for the given URL and
+ * headers. Requests with the same key are collapsed into one by
+ * {@link DeduplicatingAssetAccessor}.
+ */
+std::string createDeduplicationKey(
+    const std::string& url,
+    const std::vector<CesiumAsync::IAssetAccessor::THeader>& headers);
+
+/**
+ * @brief An asset accessor that collapses concurrent GET requests for the same
+ * URL and headers into a single request to the accessor it wraps.
+ *
+ * Tilesets and raster overlays that share terrain, imagery, or a root tileset
+ * often ask for the same URL at nearly the same time. While a GET is in
+ * flight, later GETs with an identical URL and identical headers wait on the
+ * same {@link CesiumAsync::SharedFuture} instead of issuing their own request,
+ * and all of them receive the same completed request. Other verbs are always
+ * passed through.
+ */
+class DeduplicatingAssetAccessor
+    : public CesiumAsync::IAssetAccessor,
+      public std::enable_shared_from_this<DeduplicatingAssetAccessor> {
+public:
+  DeduplicatingAssetAccessor(
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAccessor);
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  get(const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers = {}) override;
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  request(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& verb,
+      const std::string& url,
+      const std::vector<THeader>& headers = std::vector<THeader>(),
+      const gsl::span<const std::byte>& contentPayload = {}) override;
+
+  virtual void tick() noexcept override;
+
+  /**
+   * @brief Gets the number of GET requests that were passed to the wrapped
+   * accessor because no identical request was in flight.
+   */
+  int64_t getIssuedRequestCount() const noexcept;
+
+  /**
+   * @brief Gets the number of GET requests that were served by an identical
+   * request that was already in flight.
+   */
+  int64_t getCoalescedRequestCount() const noexcept;
+
+  /**
+   * @brief Gets the number of distinct GET requests currently in flight.
+   */
+  int32_t getInFlightRequestCount() const;
+
+  /**
+   * @brief Resets the issued and coalesced request counts to zero.
+   */
+  void resetStatistics() noexcept;
+
+private:
+  void removeInFlight(const std::string& key);
+
+  std::shared_ptr<CesiumAsync::IAssetAccessor> _pAccessor;
+
+  mutable std::mutex _inFlightMutex;
+  std::unordered_map<
+      std::string,
+      CesiumAsync::SharedFuture<std::shared_ptr<CesiumAsync::IAssetRequest>>>
+      _inFlight;
+
+  std::atomic<int64_t> _issuedRequestCount;
+  std::atomic<int64_t> _coalescedRequestCount;
+};
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,351 @@
+#include "HttpAssetAccessor.h"
+
+#include "DownloadBufferPool.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+
+#include <httplib.h>
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+using namespace CesiumAsync;
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+bool isSchemeSupported(const std::string& scheme) {
+  if (scheme == "http") {
+    return true;
+  }
+#ifdef CPPHTTPLIB_OPENSSL_SUPPORT
+  if (scheme == "https") {
+    return true;
+  }
+#endif
+  return false;
+}
+
+class HttpAssetResponse : public IAssetResponse {
+public:
+  HttpAssetResponse(const httplib::Response& response)
+      : _statusCode(uint16_t(response.status)),
+        _contentType(response.get_header_value("Content-Type")),
+        _headers(),
+        _data(DownloadBufferPool::acquire(response.body.size())) {
+    for (const auto& header : response.headers) {
+      this->_headers.emplace(header.first, header.second);
+    }
+    const std::byte* pBody =
+        reinterpret_cast<const std::byte*>(response.body.data());
+    this->_data.assign(pBody, pBody + response.body.size());
+    DownloadBufferPool::recordResponse(
+        response.body.size(),
+        response.body.size(),
+        0);
+  }
+
+  ~HttpAssetResponse() { DownloadBufferPool::release(std::move(this->_data)); }
+
+  virtual uint16_t statusCode() const override { return _statusCode; }
+
+  virtual std::string contentType() const override { return _contentType; }
+
+  virtual const HttpHeaders& headers() const override { return _headers; }
+
+  virtual gsl::span<const std::byte> data() const override {
+    return this->_data;
+  }
+
+private:
+  uint16_t _statusCode;
+  std::string _contentType;
+  HttpHeaders _headers;
+  std::vector<std::byte> _data;
+};
+
+class HttpAssetRequest : public IAssetRequest {
+public:
+  HttpAssetRequest(
+      const std::string& url,
+      const httplib::Request& request,
+      const httplib::Response& response)
+      : _method(request.method), _url(url), _headers(), _response(response) {
+    for (const auto& header : request.headers) {
+      this->_headers.emplace(header.first, header.second);
+    }
+  }
+
+  virtual const std::string& method() const override { return _method; }
+
+  virtual const std::string& url() const override { return _url; }
+
+  virtual const HttpHeaders& headers() const override { return _headers; }
+
+  virtual const IAssetResponse* response() const override { return &_response; }
+
+private:
+  std::string _method;
+  std::string _url;
+  HttpHeaders _headers;
+  HttpAssetResponse _response;
+};
+
+} // namespace
+
+std::optional<ParsedUrl> parseUrl(const std::string& url) {
+  const size_t schemeEnd = url.find("://");
+  if (schemeEnd == std::string::npos) {
+    return std::nullopt;
+  }
+
+  std::string scheme = url.substr(0, schemeEnd);
+  std::transform(scheme.begin(), scheme.end(), scheme.begin(), [](char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  });
+  if (!isSchemeSupported(scheme)) {
+    return std::nullopt;
+  }
+
+  const size_t authorityStart = schemeEnd + 3;
+  size_t authorityEnd = url.find_first_of("/?#", authorityStart);
+  if (authorityEnd == std::string::npos) {
+    authorityEnd = url.size();
+  }
+
+  std::string authority =
+      url.substr(authorityStart, authorityEnd - authorityStart);
+  if (authority.empty() || authority.find('@') != std::string::npos) {
+    // Credentials in the URL are left to the fallback accessor.
+    return std::nullopt;
+  }
+
+  size_t fragmentStart = url.find('#', authorityEnd);
+  if (fragmentStart == std::string::npos) {
+    fragmentStart = url.size();
+  }
+
+  std::string pathAndQuery =
+      url.substr(authorityEnd, fragmentStart - authorityEnd);
+  if (pathAndQuery.empty() || pathAndQuery[0] != '/') {
+    pathAndQuery.insert(0, "/");
+  }
+
+  return ParsedUrl{scheme + "://" + authority, std::move(pathAndQuery)};
+}
+
+HttpAssetAccessor::HttpAssetAccessor(
+    const std::shared_ptr<IAssetAccessor>& pFallback,
+    const std::vector<THeader>& defaultHeaders,
+    int32_t maximumConcurrentRequests,
+    int32_t maximumConnectionsPerHost)
+    : _pFallback(pFallback),
+      _defaultHeaders(defaultHeaders),
+      _maximumConnectionsPerHost(
+          size_t(std::max(maximumConnectionsPerHost, int32_t(1)))),
+      _queueMutex(),
+      _queueCondition(),
+      _queue(),
+      _stopping(false),
+      _workers(),
+      _connectionsMutex(),
+      _idleConnections(),
+      _activeConnections(),
+      _connectionsClosed(false) {
+  const int32_t threadCount = std::max(maximumConcurrentRequests, int32_t(1));
+  this->_workers.reserve(size_t(threadCount));
+  for (int32_t i = 0; i < threadCount; ++i) {
+    this->_workers.emplace_back([this]() { this->workerLoop(); });
+  }
+}
+
+HttpAssetAccessor::~HttpAssetAccessor() { this->shutdown(); }
+
+void HttpAssetAccessor::shutdown() {
+  std::vector<std::thread> workers;
+  std::deque<QueuedRequest> queue;
+  {
+    std::lock_guard<std::mutex> lock(this->_queueMutex);
+    this->_stopping = true;
+    workers = std::move(this->_workers);
+    queue = std::move(this->_queue);
+    this->_workers.clear();
+    this->_queue.clear();
+  }
+  this->_queueCondition.notify_all();
+
+  // Closing the sockets makes the requests in flight fail right away instead
+  // of running until they time out.
+  {
+    std::lock_guard<std::mutex> lock(this->_connectionsMutex);
+    this->_connectionsClosed = true;
+    for (httplib::Client* pClient : this->_activeConnections) {
+      pClient->stop();
+    }
+    this->_idleConnections.clear();
+  }
+
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+
+  for (QueuedRequest& request : queue) {
+    request.cancel();
+  }
+}
+
+Future<std::shared_ptr<IAssetRequest>> HttpAssetAccessor::get(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+  return this->request(asyncSystem, "GET", url, headers);
+}
+
+Future<std::shared_ptr<IAssetRequest>> HttpAssetAccessor::request(
+    const AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const gsl::span<const std::byte>& contentPayload) {
+  std::optional<ParsedUrl> maybeParsed = parseUrl(url);
+  if (!maybeParsed) {
+    return this->_pFallback
+        ->request(asyncSystem, verb, url, headers, contentPayload);
+  }
+
+  auto pRequest = std::make_shared<httplib::Request>();
+  pRequest->method = verb;
+  pRequest->path = std::move(maybeParsed->pathAndQuery);
+  for (const THeader& header : this->_defaultHeaders) {
+    pRequest->headers.emplace(header.first, header.second);
+  }
+  for (const THeader& header : headers) {
+    pRequest->headers.emplace(header.first, header.second);
+  }
+  pRequest->body.assign(
+      reinterpret_cast<const char*>(contentPayload.data()),
+      contentPayload.size());
+
+  Promise<std::shared_ptr<IAssetRequest>> promise =
+      asyncSystem.createPromise<std::shared_ptr<IAssetRequest>>();
+  Future<std::shared_ptr<IAssetRequest>> future = promise.getFuture();
+
+  QueuedRequest queued{
+      [this,
+       promise,
+       origin = std::move(maybeParsed->origin),
+       url,
+       pRequest]() {
+        std::unique_ptr<httplib::Client> pClient =
+            this->takeConnection(origin);
+        if (!pClient) {
+          promise.reject(std::runtime_error(
+              "Request canceled because the asset accessor was shut down."));
+          return;
+        }
+
+        httplib::Result result = pClient->send(*pRequest);
+        if (!result) {
+          // The connection is in an unknown state, so don't reuse it.
+          this->discardConnection(pClient.get());
+          promise.reject(std::runtime_error(
+              "Request failed: " + httplib::to_string(result.error())));
+          return;
+        }
+
+        this->returnConnection(origin, std::move(pClient));
+        promise.resolve(
+            std::make_shared<HttpAssetRequest>(url, *pRequest, *result));
+      },
+      [promise]() {
+        promise.reject(std::runtime_error(
+            "Request canceled because the asset accessor was shut down."));
+      }};
+
+  {
+    std::unique_lock<std::mutex> lock(this->_queueMutex);
+    if (!this->_stopping) {
+      this->_queue.emplace_back(std::move(queued));
+      lock.unlock();
+      this->_queueCondition.notify_one();
+      return future;
+    }
+  }
+
+  queued.cancel();
+  return future;
+}
+
+void HttpAssetAccessor::tick() noexcept { this->_pFallback->tick(); }
+
+void HttpAssetAccessor::workerLoop() {
+  while (true) {
+    QueuedRequest request;
+
+    {
+      std::unique_lock<std::mutex> lock(this->_queueMutex);
+      this->_queueCondition.wait(lock, [this]() {
+        return this->_stopping || !this->_queue.empty();
+      });
+      if (this->_stopping) {
+        return;
+      }
+
+      request = std::move(this->_queue.front());
+      this->_queue.pop_front();
+    }
+
+    request.send();
+  }
+}
+
+std::unique_ptr<httplib::Client>
+HttpAssetAccessor::takeConnection(const std::string& origin) {
+  std::lock_guard<std::mutex> lock(this->_connectionsMutex);
+  if (this->_connectionsClosed) {
+    return nullptr;
+  }
+
+  std::unique_ptr<httplib::Client> pClient;
+  auto it = this->_idleConnections.find(origin);
+  if (it != this->_idleConnections.end() && !it->second.empty()) {
+    pClient = std::move(it->second.back());
+    it->second.pop_back();
+  } else {
+    pClient = std::make_unique<httplib::Client>(origin);
+    pClient->set_keep_alive(true);
+    pClient->set_follow_location(true);
+    pClient->set_connection_timeout(30, 0);
+    pClient->set_read_timeout(60, 0);
+  }
+
+  this->_activeConnections.insert(pClient.get());
+  return pClient;
+}
+
+void HttpAssetAccessor::returnConnection(
+    const std::string& origin,
+    std::unique_ptr<httplib::Client>&& pClient) {
+  std::lock_guard<std::mutex> lock(this->_connectionsMutex);
+  this->_activeConnections.erase(pClient.get());
+  if (this->_connectionsClosed) {
+    return;
+  }
+
+  std::vector<std::unique_ptr<httplib::Client>>& idle =
+      this->_idleConnections[origin];
+  if (idle.size() < this->_maximumConnectionsPerHost) {
+    idle.emplace_back(std::move(pClient));
+  }
+}
+
+void HttpAssetAccessor::discardConnection(httplib::Client* pClient) {
+  std::lock_guard<std::mutex> lock(this->_connectionsMutex);
+  this->_activeConnections.erase(pClient);
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <CesiumAsync/IAssetAccessor.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace httplib {
+class Client;
+}
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief A URL split into the parts that the native HTTP client needs.
+ */
+struct ParsedUrl {
+  // The scheme, host, and port, such as "http://example.com:8080".
+  std::string origin;
+  // The path and query, such as "/tiles/0/0/0.b3dm?v=1".
+  std::string pathAndQuery;
+};
+
+/**
+ * @brief Splits a URL into its origin and its path and query, dropping any
+ * fragment.
+ *
+ * @returns The parts of the URL, or nothing if {@link HttpAssetAccessor}
+ * can't request it itself and passes it to its fallback accessor: the scheme
+ * isn't supported, or the URL has no host or has credentials.
+ */
+std::optional<ParsedUrl> parseUrl(const std::string& url);
+
+/**
+ * @brief An asset accessor that downloads with a native HTTP client on its
+ * own threads, without involving the Unity main thread.
+ *
+ * Requests are queued and sent by a fixed number of I/O threads, which limits
+ * how many are in flight at once. Connections are kept alive and reused for
+ * later requests to the same scheme, host, and port, up to a limit per host.
+ *
+ * URLs that the native client cannot handle, such as `file:` URLs or `https:`
+ * URLs when the client was built without TLS support, are passed to a
+ * fallback accessor instead.
+ */
+class HttpAssetAccessor : public CesiumAsync::IAssetAccessor {
+public:
+  /**
+   * @brief Creates an accessor and starts its I/O threads.
+   *
+   * @param pFallback The accessor used for URLs that the native client cannot
+   * handle.
+   * @param defaultHeaders Headers added to every request.
+   * @param maximumConcurrentRequests The number of I/O threads, and so the
+   * maximum number of requests in flight at once. Values less than 1 are
+   * treated as 1.
+   * @param maximumConnectionsPerHost The maximum number of idle keep-alive
+   * connections kept open to each host.
+   */
+  HttpAssetAccessor(
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pFallback,
+      const std::vector<THeader>& defaultHeaders,
+      int32_t maximumConcurrentRequests,
+      int32_t maximumConnectionsPerHost);
+
+  /**
+   * @brief Shuts down the accessor if {@link shutdown} was not called.
+   */
+  ~HttpAssetAccessor();
+
+  HttpAssetAccessor(const HttpAssetAccessor&) = delete;
+  HttpAssetAccessor& operator=(const HttpAssetAccessor&) = delete;
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  get(const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers = {}) override;
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  request(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& verb,
+      const std::string& url,
+      const std::vector<THeader>& headers = std::vector<THeader>(),
+      const gsl::span<const std::byte>& contentPayload = {}) override;
+
+  virtual void tick() noexcept override;
+
+  /**
+   * @brief Aborts the requests in flight, rejects the queued ones, and stops
+   * the I/O threads. Requests made afterward are rejected immediately.
+   *
+   * This must be called before the application exits rather than left to
+   * static destruction, because a request in flight may otherwise take until
+   * its timeout to finish while the native library is being unloaded.
+   */
+  void shutdown();
+
+private:
+  struct QueuedRequest {
+    // Sends the request and resolves its future. Called on an I/O thread.
+    std::function<void()> send;
+    // Rejects the future of a request that will never be sent.
+    std::function<void()> cancel;
+  };
+
+  void workerLoop();
+
+  // Takes an idle connection to the origin or opens a new one, or returns
+  // nullptr if the accessor is shutting down.
+  std::unique_ptr<httplib::Client> takeConnection(const std::string& origin);
+  void returnConnection(
+      const std::string& origin,
+      std::unique_ptr<httplib::Client>&& pClient);
+  void discardConnection(httplib::Client* pClient);
+
+  std::shared_ptr<CesiumAsync::IAssetAccessor> _pFallback;
+  std::vector<THeader> _defaultHeaders;
+  size_t _maximumConnectionsPerHost;
+
+  std::mutex _queueMutex;
+  std::condition_variable _queueCondition;
+  std::deque<QueuedRequest> _queue;
+  bool _stopping;
+  std::vector<std::thread> _workers;
+
+  std::mutex _connectionsMutex;
+  std::unordered_map<std::string, std::vector<std::unique_ptr<httplib::Client>>>
+      _idleConnections;
+  // The connections that are sending a request, so they can be aborted.
+  std::unordered_set<httplib::Client*> _activeConnections;
+  bool _connectionsClosed;
+};
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,276 @@
+#include "ImageProcessing.h"
+
+#include <CesiumGltf/ImageCesium.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace CesiumGltf;
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+constexpr size_t BYTES_PER_PIXEL = 4;
+constexpr size_t BC1_BLOCK_SIZE = 8;
+
+/**
+ * @brief Averages each 2x2 block of RGBA8 pixels into one pixel of the next
+ * mip level. Odd edges reuse their last row or column.
+ */
+void downsample(
+    const std::uint8_t* pSource,
+    int32_t sourceWidth,
+    int32_t sourceHeight,
+    std::uint8_t* pDestination,
+    int32_t width,
+    int32_t height) {
+  const size_t sourceStride = size_t(sourceWidth) * BYTES_PER_PIXEL;
+
+  for (int32_t y = 0; y < height; ++y) {
+    const std::uint8_t* pRow0 =
+        pSource + size_t(std::min(2 * y, sourceHeight - 1)) * sourceStride;
+    const std::uint8_t* pRow1 =
+        pSource + size_t(std::min(2 * y + 1, sourceHeight - 1)) * sourceStride;
+    std::uint8_t* pOut = pDestination + size_t(y) * width * BYTES_PER_PIXEL;
+
+    for (int32_t x = 0; x < width; ++x) {
+      const size_t x0 =
+          size_t(std::min(2 * x, sourceWidth - 1)) * BYTES_PER_PIXEL;
+      const size_t x1 =
+          size_t(std::min(2 * x + 1, sourceWidth - 1)) * BYTES_PER_PIXEL;
+      for (size_t c = 0; c < BYTES_PER_PIXEL; ++c) {
+        const uint32_t sum = uint32_t(pRow0[x0 + c]) + pRow0[x1 + c] +
+                             pRow1[x0 + c] + pRow1[x1 + c];
+        pOut[c] = std::uint8_t((sum + 2) >> 2);
+      }
+      pOut += BYTES_PER_PIXEL;
+    }
+  }
+}
+
+uint16_t toRgb565(const std::uint8_t* pColor) {
+  return uint16_t(
+      ((pColor[0] >> 3) << 11) | ((pColor[1] >> 2) << 5) | (pColor[2] >> 3));
+}
+
+void fromRgb565(uint16_t color, int32_t* pResult) {
+  const int32_t r = (color >> 11) & 0x1f;
+  const int32_t g = (color >> 5) & 0x3f;
+  const int32_t b = color & 0x1f;
+  pResult[0] = (r << 3) | (r >> 2);
+  pResult[1] = (g << 2) | (g >> 4);
+  pResult[2] = (b << 3) | (b >> 2);
+}
+
+/**
+ * @brief Encodes a block of 4x4 RGBA8 pixels as an opaque BC1 block.
+ *
+ * The endpoints are the corners of the block's color bounding box, inset by
+ * 1/16 of its size, and each pixel gets the closest of the four palette
+ * colors. This is fast rather than optimal.
+ */
+void encodeBC1Block(const std::uint8_t* pPixels, std::uint8_t* pBlock) {
+  std::uint8_t minimum[3] = {255, 255, 255};
+  std::uint8_t maximum[3] = {0, 0, 0};
+  for (size_t i = 0; i < 16; ++i) {
+    for (size_t c = 0; c < 3; ++c) {
+      minimum[c] = std::min(minimum[c], pPixels[i * BYTES_PER_PIXEL + c]);
+      maximum[c] = std::max(maximum[c], pPixels[i * BYTES_PER_PIXEL + c]);
+    }
+  }
+
+  for (size_t c = 0; c < 3; ++c) {
+    const std::uint8_t inset = std::uint8_t((maximum[c] - minimum[c]) >> 4);
+    minimum[c] = std::uint8_t(minimum[c] + inset);
+    maximum[c] = std::uint8_t(maximum[c] - inset);
+  }
+
+  uint16_t color0 = toRgb565(maximum);
+  uint16_t color1 = toRgb565(minimum);
+
+  // color0 > color1 selects the opaque four-color mode.
+  if (color0 < color1) {
+    std::swap(color0, color1);
+  }
+
+  uint32_t indices = 0;
+  if (color0 != color1) {
+    int32_t palette[4][3];
+    fromRgb565(color0, palette[0]);
+    fromRgb565(color1, palette[1]);
+    for (size_t c = 0; c < 3; ++c) {
+      palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+      palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    for (uint32_t i = 0; i < 16; ++i) {
+      const std::uint8_t* pPixel = pPixels + i * BYTES_PER_PIXEL;
+      uint32_t bestIndex = 0;
+      int32_t bestDistance = std::numeric_limits<int32_t>::max();
+      for (uint32_t p = 0; p < 4; ++p) {
+        const int32_t dr = pPixel[0] - palette[p][0];
+        const int32_t dg = pPixel[1] - palette[p][1];
+        const int32_t db = pPixel[2] - palette[p][2];
+        const int32_t distance = dr * dr + dg * dg + db * db;
+        if (distance < bestDistance) {
+          bestDistance = distance;
+          bestIndex = p;
+        }
+      }
+      indices |= bestIndex << (2 * i);
+    }
+  }
+
+  pBlock[0] = std::uint8_t(color0 & 0xff);
+  pBlock[1] = std::uint8_t(color0 >> 8);
+  pBlock[2] = std::uint8_t(color1 & 0xff);
+  pBlock[3] = std::uint8_t(color1 >> 8);
+  pBlock[4] = std::uint8_t(indices & 0xff);
+  pBlock[5] = std::uint8_t((indices >> 8) & 0xff);
+  pBlock[6] = std::uint8_t((indices >> 16) & 0xff);
+  pBlock[7] = std::uint8_t(indices >> 24);
+}
+
+} // namespace
+
+bool ImageProcessing::generateMipMaps(CesiumGltf::ImageCesium& image) {
+  if (!image.mipPositions.empty() ||
+      image.compressedPixelFormat != GpuCompressedPixelFormat::NONE ||
+      image.channels != 4 || image.bytesPerChannel != 1 || image.width <= 0 ||
+      image.height <= 0) {
+    return false;
+  }
+
+  const size_t baseSize = size_t(image.width) * image.height * BYTES_PER_PIXEL;
+  if (image.pixelData.size() < baseSize) {
+    return false;
+  }
+
+  // Lay out every level back to back, down to 1x1.
+  image.mipPositions.push_back(ImageCesiumMipPosition{0, baseSize});
+  int32_t width = image.width;
+  int32_t height = image.height;
+  size_t totalSize = baseSize;
+  while (width > 1 || height > 1) {
+    width = std::max(width / 2, 1);
+    height = std::max(height / 2, 1);
+    const size_t levelSize = size_t(width) * height * BYTES_PER_PIXEL;
+    image.mipPositions.push_back(ImageCesiumMipPosition{totalSize, levelSize});
+    totalSize += levelSize;
+  }
+
+  image.pixelData.resize(totalSize);
+  std::uint8_t* pData = reinterpret_cast<std::uint8_t*>(image.pixelData.data());
+
+  width = image.width;
+  height = image.height;
+  for (size_t level = 1; level < image.mipPositions.size(); ++level) {
+    const int32_t levelWidth = std::max(width / 2, 1);
+    const int32_t levelHeight = std::max(height / 2, 1);
+    downsample(
+        pData + image.mipPositions[level - 1].byteOffset,
+        width,
+        height,
+        pData + image.mipPositions[level].byteOffset,
+        levelWidth,
+        levelHeight);
+    width = levelWidth;
+    height = levelHeight;
+  }
+
+  return true;
+}
+
+bool ImageProcessing::compressToBC1(CesiumGltf::ImageCesium& image) {
+  // Graphics APIs reject block-compressed textures whose base level isn't a
+  // whole number of blocks, though smaller mips may be partial blocks.
+  if (image.compressedPixelFormat != GpuCompressedPixelFormat::NONE ||
+      image.channels != 4 || image.bytesPerChannel != 1 || image.width <= 0 ||
+      image.height <= 0 || image.width % 4 != 0 || image.height % 4 != 0) {
+    return false;
+  }
+
+  std::vector<ImageCesiumMipPosition> levels = image.mipPositions;
+  if (levels.empty()) {
+    levels.push_back(ImageCesiumMipPosition{
+        0,
+        size_t(image.width) * image.height * BYTES_PER_PIXEL});
+  }
+
+  if (levels.back().byteOffset + levels.back().byteSize >
+      image.pixelData.size()) {
+    return false;
+  }
+
+  const std::uint8_t* pSource =
+      reinterpret_cast<const std::uint8_t*>(image.pixelData.data());
+
+  // BC1 has at most one bit of alpha, so only compress opaque images. The
+  // mips are derived from the base level, so checking it is enough.
+  for (size_t i = 3; i < levels[0].byteSize; i += BYTES_PER_PIXEL) {
+    if (pSource[i] != 255) {
+      return false;
+    }
+  }
+
+  // Each level is stored as whole 4x4 blocks of 8 bytes.
+  std::vector<ImageCesiumMipPosition> compressedLevels;
+  compressedLevels.reserve(levels.size());
+  size_t compressedSize = 0;
+  int32_t width = image.width;
+  int32_t height = image.height;
+  for (size_t level = 0; level < levels.size(); ++level) {
+    const size_t levelSize =
+        size_t((width + 3) / 4) * size_t((height + 3) / 4) * BC1_BLOCK_SIZE;
+    compressedLevels.push_back(
+        ImageCesiumMipPosition{compressedSize, levelSize});
+    compressedSize += levelSize;
+    width = std::max(width / 2, 1);
+    height = std::max(height / 2, 1);
+  }
+
+  std::vector<std::byte> compressed(compressedSize);
+  std::uint8_t* pCompressed =
+      reinterpret_cast<std::uint8_t*>(compressed.data());
+
+  width = image.width;
+  height = image.height;
+  for (size_t level = 0; level < levels.size(); ++level) {
+    const std::uint8_t* pLevel = pSource + levels[level].byteOffset;
+    std::uint8_t* pBlock = pCompressed + compressedLevels[level].byteOffset;
+
+    for (int32_t blockY = 0; blockY < height; blockY += 4) {
+      for (int32_t blockX = 0; blockX < width; blockX += 4) {
+        // Blocks that extend past the edge of the level repeat its last row
+        // or column.
+        std::uint8_t pixels[16 * BYTES_PER_PIXEL];
+        for (int32_t y = 0; y < 4; ++y) {
+          const int32_t sourceY = std::min(blockY + y, height - 1);
+          for (int32_t x = 0; x < 4; ++x) {
+            const int32_t sourceX = std::min(blockX + x, width - 1);
+            std::memcpy(
+                pixels + size_t(y * 4 + x) * BYTES_PER_PIXEL,
+                pLevel + (size_t(sourceY) * width + sourceX) * BYTES_PER_PIXEL,
+                BYTES_PER_PIXEL);
+          }
+        }
+
+        encodeBC1Block(pixels, pBlock);
+        pBlock += BC1_BLOCK_SIZE;
+      }
+    }
+
+    width = std::max(width / 2, 1);
+    height = std::max(height / 2, 1);
+  }
+
+  image.pixelData = std::move(compressed);
+  image.mipPositions = std::move(compressedLevels);
+  image.compressedPixelFormat = GpuCompressedPixelFormat::BC1_RGB;
+  return true;
+}
+
+} // namespace CesiumForUnityNative
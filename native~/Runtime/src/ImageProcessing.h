@@ -0,0 +1,42 @@
+#pragma once
+
+namespace CesiumGltf {
+struct ImageCesium;
+} // namespace CesiumGltf
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief Prepares decoded images for upload in worker threads, so that Unity
+ * doesn't have to do it on the main thread.
+ *
+ * These functions don't use any Unity APIs, and may be called from any
+ * thread.
+ */
+class ImageProcessing {
+public:
+  /**
+   * @brief Generates the full mip chain of an RGBA8 image with a box filter,
+   * appending every level to its pixel data.
+   *
+   * The levels are laid out the way Unity expects the raw data of a
+   * Texture2D with a mip chain, so {@link TextureLoader::loadTexture} can
+   * upload them directly.
+   *
+   * @returns true if mips were generated, or false if the image already has
+   * mips or is not an uncompressed RGBA8 image.
+   */
+  static bool generateMipMaps(CesiumGltf::ImageCesium& image);
+
+  /**
+   * @brief Compresses an opaque RGBA8 image, and its mips if it has any, to
+   * BC1 with a fast real-time encoder.
+   *
+   * @returns true if the image was compressed, or false if it is already
+   * compressed, is not RGBA8, is not fully opaque, or its width or height is
+   * not a multiple of 4.
+   */
+  static bool compressToBC1(CesiumGltf::ImageCesium& image);
+};
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,95 @@
+#include "MaterialCache.h"
+
+#include "UnityLifetime.h"
+
+#include <DotNet/UnityEngine/HideFlags.h>
+#include <DotNet/UnityEngine/Object.h>
+#include <DotNet/UnityEngine/Vector4.h>
+
+#include <functional>
+
+using namespace DotNet;
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+void hashCombine(size_t& seed, size_t value) {
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+} // namespace
+
+size_t MaterialKeyHash::operator()(const MaterialKey& key) const {
+  std::hash<int32_t> hashInt;
+  std::hash<float> hashFloat;
+
+  size_t result = hashInt(key.baseMaterialInstanceID);
+  for (const auto& [propertyID, value] : key.floatProperties) {
+    hashCombine(result, hashInt(propertyID));
+    hashCombine(result, hashFloat(value));
+  }
+  for (const auto& [propertyID, value] : key.vectorProperties) {
+    hashCombine(result, hashInt(propertyID));
+    for (glm::length_t i = 0; i < 4; ++i) {
+      hashCombine(result, hashFloat(value[i]));
+    }
+  }
+  for (const auto& [propertyID, instanceID] : key.textureInstanceIDs) {
+    hashCombine(result, hashInt(propertyID));
+    hashCombine(result, hashInt(instanceID));
+  }
+  return result;
+}
+
+UnityEngine::Material MaterialCache::acquire(
+    const MaterialKey& key,
+    const UnityEngine::Material& baseMaterial) {
+  auto it = this->_materials.find(key);
+  if (it != this->_materials.end()) {
+    ++it->second.referenceCount;
+    return it->second.material;
+  }
+
+  UnityEngine::Material material =
+      UnityEngine::Object::Instantiate(baseMaterial);
+  material.hideFlags(UnityEngine::HideFlags::HideAndDontSave);
+
+  for (const auto& [propertyID, value] : key.floatProperties) {
+    material.SetFloat(propertyID, value);
+  }
+  for (const auto& [propertyID, value] : key.vectorProperties) {
+    material.SetVector(
+        propertyID,
+        UnityEngine::Vector4{value.x, value.y, value.z, value.w});
+  }
+  for (const auto& [propertyID, texture] : key.textureProperties) {
+    material.SetTexture(propertyID, texture);
+  }
+
+  this->_materials.emplace(key, Entry{material, 1});
+  this->_keysByInstanceID.emplace(material.GetInstanceID(), key);
+  return material;
+}
+
+void MaterialCache::release(const UnityEngine::Material& material) {
+  auto keyIt = this->_keysByInstanceID.find(material.GetInstanceID());
+  if (keyIt == this->_keysByInstanceID.end()) {
+    // Not a cached material, so it is owned by the caller.
+    UnityLifetime::Destroy(material);
+    return;
+  }
+
+  auto it = this->_materials.find(keyIt->second);
+  if (it != this->_materials.end() && --it->second.referenceCount > 0) {
+    return;
+  }
+
+  if (it != this->_materials.end()) {
+    this->_materials.erase(it);
+  }
+  this->_keysByInstanceID.erase(keyIt);
+  UnityLifetime::Destroy(material);
+}
+
+} // namespace CesiumForUnityNative
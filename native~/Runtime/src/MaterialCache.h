@@ -0,0 +1,129 @@
+#pragma once
+
+#include <DotNet/UnityEngine/Material.h>
+#include <DotNet/UnityEngine/Texture.h>
+#include <glm/vec4.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief The resolved parameters of a tile material: the material it is
+ * instantiated from and the values of the properties that are set on it.
+ *
+ * With the built-in render pipeline, textures are not part of the key. They
+ * are set per renderer with a MaterialPropertyBlock, so that primitives with
+ * different textures can still share a material. The SRP Batcher of the
+ * scriptable render pipelines does not batch renderers that have property
+ * blocks, so with those pipelines the textures are set on the material and
+ * are part of the key instead.
+ */
+struct MaterialKey {
+  /**
+   * @brief The instance ID of the material that is instantiated.
+   */
+  int32_t baseMaterialInstanceID = 0;
+
+  std::vector<std::pair<int32_t, float>> floatProperties{};
+  std::vector<std::pair<int32_t, glm::vec4>> vectorProperties{};
+
+  /**
+   * @brief The instance IDs of the textures set on the material, which
+   * identify them in the key.
+   */
+  std::vector<std::pair<int32_t, int32_t>> textureInstanceIDs{};
+  std::vector<std::pair<int32_t, ::DotNet::UnityEngine::Texture>>
+      textureProperties{};
+
+  void setFloat(int32_t propertyID, float value) {
+    setProperty(this->floatProperties, propertyID, value);
+  }
+
+  void setVector(int32_t propertyID, const glm::vec4& value) {
+    setProperty(this->vectorProperties, propertyID, value);
+  }
+
+  void setTexture(
+      int32_t propertyID,
+      const ::DotNet::UnityEngine::Texture& texture) {
+    setProperty(this->textureInstanceIDs, propertyID, texture.GetInstanceID());
+    setProperty(this->textureProperties, propertyID, texture);
+  }
+
+  bool operator==(const MaterialKey& rhs) const {
+    return this->baseMaterialInstanceID == rhs.baseMaterialInstanceID &&
+           this->floatProperties == rhs.floatProperties &&
+           this->vectorProperties == rhs.vectorProperties &&
+           this->textureInstanceIDs == rhs.textureInstanceIDs;
+  }
+
+private:
+  // Setting a property again replaces its value, so that a key only depends
+  // on the final values of its properties.
+  template <typename T>
+  static void setProperty(
+      std::vector<std::pair<int32_t, T>>& properties,
+      int32_t propertyID,
+      const T& value) {
+    for (std::pair<int32_t, T>& property : properties) {
+      if (property.first == propertyID) {
+        property.second = value;
+        return;
+      }
+    }
+    properties.emplace_back(propertyID, value);
+  }
+};
+
+struct MaterialKeyHash {
+  size_t operator()(const MaterialKey& key) const;
+};
+
+/**
+ * @brief Shares material instances between the primitives of a tileset that
+ * have the same resolved material parameters.
+ *
+ * Materials are reference counted and destroyed when the last primitive that
+ * uses them is freed. All methods must be called from the main thread.
+ */
+class MaterialCache {
+public:
+  /**
+   * @brief Gets the material for the given key, creating it if necessary,
+   * and adds a reference to it.
+   *
+   * @param key The resolved material parameters.
+   * @param baseMaterial The material to instantiate. Its instance ID must be
+   * the one in the key.
+   */
+  ::DotNet::UnityEngine::Material acquire(
+      const MaterialKey& key,
+      const ::DotNet::UnityEngine::Material& baseMaterial);
+
+  /**
+   * @brief Removes a reference to a material obtained from {@link acquire},
+   * destroying it if this was the last reference.
+   */
+  void release(const ::DotNet::UnityEngine::Material& material);
+
+  /**
+   * @brief Gets the number of distinct materials currently in the cache.
+   */
+  size_t size() const { return this->_materials.size(); }
+
+private:
+  struct Entry {
+    ::DotNet::UnityEngine::Material material;
+    int32_t referenceCount;
+  };
+
+  std::unordered_map<MaterialKey, Entry, MaterialKeyHash> _materials;
+  std::unordered_map<int32_t, MaterialKey> _keysByInstanceID;
+};
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,124 @@
+#include "MeshDataArrayPool.h"
+
+#include <DotNet/UnityEngine/Mesh.h>
+#include <DotNet/UnityEngine/MeshDataArray.h>
+#include <DotNet/UnityEngine/Time.h>
+
+#include <algorithm>
+#include <mutex>
+
+using namespace DotNet;
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+// The pool never shrinks below this many arrays, so that a burst of tile
+// loads after a camera jump doesn't have to wait for the main thread.
+constexpr int32_t MINIMUM_POOL_SIZE = 32;
+
+// Upper bound on the number of arrays kept in the pool. Each one holds a
+// small native allocation until it is used or disposed.
+constexpr int32_t MAXIMUM_POOL_SIZE = 512;
+
+std::mutex poolMutex;
+std::vector<UnityEngine::MeshDataArray> pool;
+int32_t requestedSinceRefill = 0;
+int32_t userCount = 0;
+int32_t lastRefillFrame = -1;
+
+void disposeAll(std::vector<UnityEngine::MeshDataArray>& arrays) {
+  for (UnityEngine::MeshDataArray& meshDataArray : arrays) {
+    meshDataArray.Dispose();
+  }
+  arrays.clear();
+}
+
+} // namespace
+
+void MeshDataArrayPool::addUser() { ++userCount; }
+
+void MeshDataArrayPool::removeUser() {
+  if (userCount > 0 && --userCount == 0) {
+    std::vector<UnityEngine::MeshDataArray> arrays;
+    {
+      std::lock_guard<std::mutex> lock(poolMutex);
+      arrays = std::move(pool);
+      pool.clear();
+      requestedSinceRefill = 0;
+    }
+    disposeAll(arrays);
+  }
+}
+
+void MeshDataArrayPool::refill() {
+  if (userCount == 0) {
+    return;
+  }
+
+  // Every tileset calls this from its Update, but the demand counter covers
+  // all of them, so only the first call in a frame refills the pool.
+  const int32_t frame = UnityEngine::Time::frameCount();
+  if (frame == lastRefillFrame) {
+    return;
+  }
+  lastRefillFrame = frame;
+
+  int32_t missing = 0;
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    const int32_t targetSize = std::clamp(
+        requestedSinceRefill,
+        MINIMUM_POOL_SIZE,
+        MAXIMUM_POOL_SIZE);
+    requestedSinceRefill = 0;
+    missing = targetSize - static_cast<int32_t>(pool.size());
+  }
+
+  if (missing <= 0) {
+    return;
+  }
+
+  // Allocate outside the lock so workers can keep taking arrays meanwhile.
+  std::vector<UnityEngine::MeshDataArray> arrays = allocate(missing);
+
+  std::lock_guard<std::mutex> lock(poolMutex);
+  pool.insert(
+      pool.end(),
+      std::make_move_iterator(arrays.begin()),
+      std::make_move_iterator(arrays.end()));
+}
+
+int32_t MeshDataArrayPool::take(
+    int32_t count,
+    std::vector<UnityEngine::MeshDataArray>& result) {
+  std::lock_guard<std::mutex> lock(poolMutex);
+  requestedSinceRefill += count;
+
+  const int32_t taken =
+      std::clamp(static_cast<int32_t>(pool.size()), 0, std::max(count, 0));
+  if (taken == 0) {
+    return 0;
+  }
+
+  result.reserve(result.size() + taken);
+  auto takeFrom = pool.end() - taken;
+  result.insert(
+      result.end(),
+      std::make_move_iterator(takeFrom),
+      std::make_move_iterator(pool.end()));
+  pool.erase(takeFrom, pool.end());
+  return taken;
+}
+
+std::vector<UnityEngine::MeshDataArray>
+MeshDataArrayPool::allocate(int32_t count) {
+  std::vector<UnityEngine::MeshDataArray> result;
+  result.reserve(std::max(count, 0));
+  for (int32_t i = 0; i < count; ++i) {
+    result.emplace_back(UnityEngine::Mesh::AllocateWritableMeshData(1));
+  }
+  return result;
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <DotNet/UnityEngine/MeshDataArray.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief A pool of writable, single-mesh MeshDataArrays.
+ *
+ * Unity only allows writable mesh data to be allocated on the main thread.
+ * Instead of asking the main thread for a MeshDataArray for every tile, the
+ * main thread refills this pool once per frame and worker threads take
+ * arrays from it without waiting.
+ */
+class MeshDataArrayPool {
+public:
+  /**
+   * @brief Registers a user of the pool. The pool is only kept alive while it
+   * has at least one user.
+   *
+   * Must be called from the main thread.
+   */
+  static void addUser();
+
+  /**
+   * @brief Unregisters a user of the pool. When the last user is removed, all
+   * pooled arrays are disposed.
+   *
+   * Must be called from the main thread.
+   */
+  static void removeUser();
+
+  /**
+   * @brief Allocates enough arrays to bring the pool back up to its target
+   * size. The target size follows the demand seen since the last refill.
+   *
+   * Only the first call in a frame does anything, so every user may call this
+   * from its own update. Must be called from the main thread.
+   */
+  static void refill();
+
+  /**
+   * @brief Takes up to `count` single-mesh arrays from the pool.
+   *
+   * This may be called from any thread and never waits for the main thread.
+   * If the pool has fewer than `count` arrays, all of them are taken and the
+   * caller must allocate the rest with {@link allocate}.
+   *
+   * @param count The number of arrays wanted.
+   * @param result Receives the arrays that were taken.
+   * @returns The number of arrays taken.
+   */
+  static int32_t take(
+      int32_t count,
+      std::vector<::DotNet::UnityEngine::MeshDataArray>& result);
+
+  /**
+   * @brief Allocates `count` single-mesh arrays directly, bypassing the pool.
+   *
+   * Must be called from the main thread.
+   */
+  static std::vector<::DotNet::UnityEngine::MeshDataArray>
+  allocate(int32_t count);
+};
+
+} // namespace CesiumForUnityNative
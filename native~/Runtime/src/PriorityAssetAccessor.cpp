@@ -0,0 +1,73 @@
+#include "PriorityAssetAccessor.h"
+
+#include "PriorityTaskProcessor.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+
+#include <stdexcept>
+
+using namespace CesiumAsync;
+
+namespace {
+
+using CesiumForUnityNative::PriorityTaskProcessor;
+using CesiumForUnityNative::TaskPriority;
+
+Future<std::shared_ptr<IAssetRequest>> completeInCurrentLane(
+    const AsyncSystem& asyncSystem,
+    Future<std::shared_ptr<IAssetRequest>>&& future) {
+  const TaskPriority priority = PriorityTaskProcessor::getCurrentPriority();
+
+  // Continuations are scheduled by the thread that resolves the promise,
+  // while it is resolving it, so they start in the scope's lane.
+  Promise<std::shared_ptr<IAssetRequest>> promise =
+      asyncSystem.createPromise<std::shared_ptr<IAssetRequest>>();
+  Future<std::shared_ptr<IAssetRequest>> result = promise.getFuture();
+
+  std::move(future)
+      .thenImmediately(
+          [priority, promise](std::shared_ptr<IAssetRequest>&& pRequest) {
+            PriorityTaskProcessor::Scope scope(priority);
+            promise.resolve(std::move(pRequest));
+          })
+      .catchImmediately([priority, promise](std::exception&& e) {
+        PriorityTaskProcessor::Scope scope(priority);
+        promise.reject(std::runtime_error(e.what()));
+      });
+
+  return result;
+}
+
+} // namespace
+
+namespace CesiumForUnityNative {
+
+PriorityAssetAccessor::PriorityAssetAccessor(
+    const std::shared_ptr<IAssetAccessor>& pAccessor)
+    : _pAccessor(pAccessor) {}
+
+Future<std::shared_ptr<IAssetRequest>> PriorityAssetAccessor::get(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+  return completeInCurrentLane(
+      asyncSystem,
+      this->_pAccessor->get(asyncSystem, url, headers));
+}
+
+Future<std::shared_ptr<IAssetRequest>> PriorityAssetAccessor::request(
+    const AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const gsl::span<const std::byte>& contentPayload) {
+  return completeInCurrentLane(
+      asyncSystem,
+      this->_pAccessor
+          ->request(asyncSystem, verb, url, headers, contentPayload));
+}
+
+void PriorityAssetAccessor::tick() noexcept { this->_pAccessor->tick(); }
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <CesiumAsync/IAssetAccessor.h>
+
+#include <memory>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief An asset accessor that completes each request in the
+ * {@link PriorityTaskProcessor} lane it was issued from.
+ *
+ * Downloads complete on threads that have no lane of their own, such as the
+ * Unity main thread or an I/O thread of a native HTTP client, so worker
+ * continuations of a download would otherwise all run in the medium lane. This
+ * accessor remembers the lane of the thread that issues a request, and
+ * completes the request's future inside a
+ * {@link PriorityTaskProcessor::Scope} for that lane, so that continuations
+ * scheduled as it completes are put back in the right lane.
+ */
+class PriorityAssetAccessor : public CesiumAsync::IAssetAccessor {
+public:
+  PriorityAssetAccessor(
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAccessor);
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  get(const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers = {}) override;
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  request(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& verb,
+      const std::string& url,
+      const std::vector<THeader>& headers = std::vector<THeader>(),
+      const gsl::span<const std::byte>& contentPayload = {}) override;
+
+  virtual void tick() noexcept override;
+
+private:
+  std::shared_ptr<CesiumAsync::IAssetAccessor> _pAccessor;
+};
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,212 @@
+#include "StaleWhileRevalidateAssetAccessor.h"
+
+#include "CountingCacheDatabase.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/CacheItem.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+
+#include <algorithm>
+#include <cctype>
+
+using namespace CesiumAsync;
+
+namespace {
+
+class CachedAssetResponse : public IAssetResponse {
+public:
+  CachedAssetResponse(CacheResponse&& response)
+      : _response(std::move(response)) {}
+
+  virtual uint16_t statusCode() const override {
+    return this->_response.statusCode;
+  }
+
+  virtual std::string contentType() const override {
+    auto it = this->_response.headers.find("Content-Type");
+    return it != this->_response.headers.end() ? it->second : std::string();
+  }
+
+  virtual const HttpHeaders& headers() const override {
+    return this->_response.headers;
+  }
+
+  virtual gsl::span<const std::byte> data() const override {
+    return this->_response.data;
+  }
+
+private:
+  CacheResponse _response;
+};
+
+class CachedAssetRequest : public IAssetRequest {
+public:
+  CachedAssetRequest(CacheItem&& item)
+      : _request(std::move(item.cacheRequest)),
+        _response(std::move(item.cacheResponse)) {}
+
+  virtual const std::string& method() const override {
+    return this->_request.method;
+  }
+
+  virtual const std::string& url() const override {
+    return this->_request.url;
+  }
+
+  virtual const HttpHeaders& headers() const override {
+    return this->_request.headers;
+  }
+
+  virtual const IAssetResponse* response() const override {
+    return &this->_response;
+  }
+
+private:
+  CacheRequest _request;
+  CachedAssetResponse _response;
+};
+
+bool requiresRevalidation(const HttpHeaders& headers) {
+  auto it = headers.find("Cache-Control");
+  if (it == headers.end()) {
+    return false;
+  }
+
+  std::string cacheControl = it->second;
+  std::transform(
+      cacheControl.begin(),
+      cacheControl.end(),
+      cacheControl.begin(),
+      [](char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+      });
+  return cacheControl.find("no-cache") != std::string::npos ||
+         cacheControl.find("must-revalidate") != std::string::npos;
+}
+
+} // namespace
+
+namespace CesiumForUnityNative {
+
+StaleWhileRevalidateAssetAccessor::StaleWhileRevalidateAssetAccessor(
+    const std::shared_ptr<IAssetAccessor>& pCachingAccessor,
+    const std::shared_ptr<CountingCacheDatabase>& pCacheDatabase,
+    std::time_t maximumStaleness)
+    : _pCachingAccessor(pCachingAccessor),
+      _pCacheDatabase(pCacheDatabase),
+      _maximumStaleness(maximumStaleness),
+      _revalidatingMutex(),
+      _revalidating(),
+      _freshHitCount(0),
+      _staleHitCount(0),
+      _revalidationCount(0) {}
+
+Future<std::shared_ptr<IAssetRequest>> StaleWhileRevalidateAssetAccessor::get(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+  // Like the CachingAssetAccessor, read the cache in a worker thread, since
+  // requests may be made from the main thread.
+  return asyncSystem.runInWorkerThread(
+      [pThis = this->shared_from_this(), asyncSystem, url, headers]()
+          -> Future<std::shared_ptr<IAssetRequest>> {
+        // CachingAssetAccessor stores entries under their URL.
+        std::optional<CacheItem> maybeItem =
+            pThis->_pCacheDatabase->peekEntry(url);
+
+        bool serve = false;
+        const std::time_t now = std::time(nullptr);
+        if (maybeItem &&
+            !requiresRevalidation(maybeItem->cacheResponse.headers)) {
+          if (maybeItem->expiryTime >= now) {
+            ++pThis->_freshHitCount;
+            serve = true;
+          } else if (
+              now - maybeItem->expiryTime <= pThis->_maximumStaleness) {
+            ++pThis->_staleHitCount;
+            pThis->revalidate(asyncSystem, url, headers);
+            serve = true;
+          }
+        }
+
+        if (!serve) {
+          // The caching accessor looks the entry up again, so hand it this
+          // lookup rather than have it read the entry a second time.
+          pThis->_pCacheDatabase->primeEntry(url, std::move(maybeItem));
+          return pThis->_pCachingAccessor->get(asyncSystem, url, headers);
+        }
+
+        return asyncSystem
+            .createResolvedFuture<std::shared_ptr<IAssetRequest>>(
+                std::make_shared<CachedAssetRequest>(std::move(*maybeItem)));
+      });
+}
+
+Future<std::shared_ptr<IAssetRequest>>
+StaleWhileRevalidateAssetAccessor::request(
+    const AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const gsl::span<const std::byte>& contentPayload) {
+  if (verb == "GET" && contentPayload.empty()) {
+    return this->get(asyncSystem, url, headers);
+  }
+  return this->_pCachingAccessor
+      ->request(asyncSystem, verb, url, headers, contentPayload);
+}
+
+void StaleWhileRevalidateAssetAccessor::tick() noexcept {
+  this->_pCachingAccessor->tick();
+}
+
+int64_t StaleWhileRevalidateAssetAccessor::getFreshHitCount() const noexcept {
+  return this->_freshHitCount;
+}
+
+int64_t StaleWhileRevalidateAssetAccessor::getStaleHitCount() const noexcept {
+  return this->_staleHitCount;
+}
+
+int64_t
+StaleWhileRevalidateAssetAccessor::getRevalidationCount() const noexcept {
+  return this->_revalidationCount;
+}
+
+void StaleWhileRevalidateAssetAccessor::resetStatistics() noexcept {
+  this->_freshHitCount = 0;
+  this->_staleHitCount = 0;
+  this->_revalidationCount = 0;
+}
+
+void StaleWhileRevalidateAssetAccessor::revalidate(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+  {
+    std::lock_guard<std::mutex> lock(this->_revalidatingMutex);
+    if (!this->_revalidating.insert(url).second) {
+      // Already being revalidated.
+      return;
+    }
+  }
+
+  ++this->_revalidationCount;
+
+  std::shared_ptr<StaleWhileRevalidateAssetAccessor> pThis =
+      this->shared_from_this();
+  auto finish = [pThis, url]() {
+    std::lock_guard<std::mutex> lock(pThis->_revalidatingMutex);
+    pThis->_revalidating.erase(url);
+  };
+
+  // The caching accessor sends the conditional request and updates the
+  // cache entry, so there's nothing to do with the result.
+  this->_pCachingAccessor->get(asyncSystem, url, headers)
+      .thenImmediately(
+          [finish](std::shared_ptr<IAssetRequest>&&) { finish(); })
+      .catchImmediately([finish](std::exception&&) { finish(); });
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <CesiumAsync/IAssetAccessor.h>
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+namespace CesiumForUnityNative {
+
+class CountingCacheDatabase;
+
+/**
+ * @brief An asset accessor that answers GET requests straight from the
+ * request cache, including with entries that have expired, and revalidates
+ * expired entries in the background.
+ *
+ * Wraps the CachingAssetAccessor that owns the cache. A fresh entry is served
+ * without going through it. An expired entry is served immediately as well, as
+ * long as it expired no more than the maximum staleness ago and its response
+ * doesn't require revalidation with `no-cache` or `must-revalidate`, and the
+ * same request is then passed to the CachingAssetAccessor in the background.
+ * That sends a conditional request with `If-None-Match` or
+ * `If-Modified-Since`, and updates the entry from either the 304 or the new
+ * response, so the next request is served the current content. Everything
+ * else is passed through.
+ */
+class StaleWhileRevalidateAssetAccessor
+    : public CesiumAsync::IAssetAccessor,
+      public std::enable_shared_from_this<StaleWhileRevalidateAssetAccessor> {
+public:
+  /**
+   * @brief Creates an accessor.
+   *
+   * @param pCachingAccessor The caching accessor to pass misses and
+   * revalidations to.
+   * @param pCacheDatabase The cache database that the caching accessor uses.
+   * Entries are read from it without being counted, and when a request is
+   * passed on to the caching accessor, the entry already read is handed to
+   * it so that it isn't read twice.
+   * @param maximumStaleness The longest time, in seconds, after an entry
+   * expires that it may still be served while it is revalidated.
+   */
+  StaleWhileRevalidateAssetAccessor(
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pCachingAccessor,
+      const std::shared_ptr<CountingCacheDatabase>& pCacheDatabase,
+      std::time_t maximumStaleness);
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  get(const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers = {}) override;
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  request(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& verb,
+      const std::string& url,
+      const std::vector<THeader>& headers = std::vector<THeader>(),
+      const gsl::span<const std::byte>& contentPayload = {}) override;
+
+  virtual void tick() noexcept override;
+
+  /**
+   * @brief Gets the number of requests served with an entry that had not
+   * expired.
+   */
+  int64_t getFreshHitCount() const noexcept;
+
+  /**
+   * @brief Gets the number of requests served with an expired entry while it
+   * was revalidated.
+   */
+  int64_t getStaleHitCount() const noexcept;
+
+  /**
+   * @brief Gets the number of background revalidations started.
+   */
+  int64_t getRevalidationCount() const noexcept;
+
+  void resetStatistics() noexcept;
+
+private:
+  void revalidate(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers);
+
+  std::shared_ptr<CesiumAsync::IAssetAccessor> _pCachingAccessor;
+  std::shared_ptr<CountingCacheDatabase> _pCacheDatabase;
+  std::time_t _maximumStaleness;
+
+  std::mutex _revalidatingMutex;
+  std::unordered_set<std::string> _revalidating;
+
+  std::atomic<int64_t> _freshHitCount;
+  std::atomic<int64_t> _staleHitCount;
+  std::atomic<int64_t> _revalidationCount;
+};
+
+} // namespace CesiumForUnityNative
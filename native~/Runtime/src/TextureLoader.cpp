@@ -1,35 +1,165 @@
 #include "TextureLoader.h"
 
+#include "TexturePool.h"
+
+#include <CesiumGltf/ImageCesium.h>
+#include <CesiumGltf/Ktx2TranscodeTargets.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumGltf/Sampler.h>
 
 #include <DotNet/Unity/Collections/LowLevel/Unsafe/NativeArrayUnsafeUtility.h>
 #include <DotNet/Unity/Collections/NativeArray1.h>
 #include <DotNet/UnityEngine/FilterMode.h>
+#include <DotNet/UnityEngine/Graphics.h>
+#include <DotNet/UnityEngine/SystemInfo.h>
 #include <DotNet/UnityEngine/Texture.h>
 #include <DotNet/UnityEngine/Texture2D.h>
 #include <DotNet/UnityEngine/TextureFormat.h>
 #include <DotNet/UnityEngine/TextureWrapMode.h>
 
+#include <algorithm>
 #include <cstring>
+#include <optional>
 
 using namespace CesiumGltf;
 using namespace DotNet;
 
 namespace CesiumForUnityNative {
 
-UnityEngine::Texture
-TextureLoader::loadTexture(const CesiumGltf::ImageCesium& image) {
-  UnityEngine::Texture2D result(
-      image.width,
-      image.height,
-      UnityEngine::TextureFormat::RGBA32,
-      true,
-      false);
-  result.hideFlags(UnityEngine::HideFlags::HideAndDontSave);
+namespace {
+
+/**
+ * @brief Gets the Unity texture format that holds pixels in the given format,
+ * or nothing if Unity has no such format.
+ */
+std::optional<UnityEngine::TextureFormat>
+getTextureFormat(GpuCompressedPixelFormat format) {
+  switch (format) {
+  case GpuCompressedPixelFormat::NONE:
+    return UnityEngine::TextureFormat::RGBA32;
+  case GpuCompressedPixelFormat::ETC1_RGB:
+    return UnityEngine::TextureFormat::ETC_RGB4;
+  case GpuCompressedPixelFormat::ETC2_RGBA:
+    return UnityEngine::TextureFormat::ETC2_RGBA8;
+  case GpuCompressedPixelFormat::BC1_RGB:
+    return UnityEngine::TextureFormat::DXT1;
+  case GpuCompressedPixelFormat::BC3_RGBA:
+    return UnityEngine::TextureFormat::DXT5;
+  case GpuCompressedPixelFormat::BC4_R:
+    return UnityEngine::TextureFormat::BC4;
+  case GpuCompressedPixelFormat::BC5_RG:
+    return UnityEngine::TextureFormat::BC5;
+  case GpuCompressedPixelFormat::BC7_RGBA:
+    return UnityEngine::TextureFormat::BC7;
+  case GpuCompressedPixelFormat::PVRTC1_4_RGB:
+    return UnityEngine::TextureFormat::PVRTC_RGB4;
+  case GpuCompressedPixelFormat::PVRTC1_4_RGBA:
+    return UnityEngine::TextureFormat::PVRTC_RGBA4;
+  case GpuCompressedPixelFormat::ASTC_4x4_RGBA:
+    return UnityEngine::TextureFormat::ASTC_4x4;
+  case GpuCompressedPixelFormat::ETC2_EAC_R11:
+    return UnityEngine::TextureFormat::EAC_R;
+  case GpuCompressedPixelFormat::ETC2_EAC_RG11:
+    return UnityEngine::TextureFormat::EAC_RG;
+  default:
+    // PVRTC2 has no Unity texture format.
+    return std::nullopt;
+  }
+}
+
+} // namespace
+
+SupportedGpuCompressedPixelFormats
+TextureLoader::getSupportedGpuCompressedPixelFormats() {
+  // What the device supports does not change, so only ask Unity once.
+  static const SupportedGpuCompressedPixelFormats supported = []() {
+    auto supports = [](UnityEngine::TextureFormat format) {
+      return UnityEngine::SystemInfo::SupportsTextureFormat(format);
+    };
+
+    SupportedGpuCompressedPixelFormats result;
+    result.ETC1_RGB = supports(UnityEngine::TextureFormat::ETC_RGB4);
+    result.ETC2_RGBA = supports(UnityEngine::TextureFormat::ETC2_RGBA8);
+    result.BC1_RGB = supports(UnityEngine::TextureFormat::DXT1);
+    result.BC3_RGBA = supports(UnityEngine::TextureFormat::DXT5);
+    result.BC4_R = supports(UnityEngine::TextureFormat::BC4);
+    result.BC5_RG = supports(UnityEngine::TextureFormat::BC5);
+    result.BC7_RGBA = supports(UnityEngine::TextureFormat::BC7);
+    result.PVRTC1_4_RGB = supports(UnityEngine::TextureFormat::PVRTC_RGB4);
+    result.PVRTC1_4_RGBA = supports(UnityEngine::TextureFormat::PVRTC_RGBA4);
+    result.ASTC_4x4_RGBA = supports(UnityEngine::TextureFormat::ASTC_4x4);
+    result.ETC2_EAC_R11 = supports(UnityEngine::TextureFormat::EAC_R);
+    result.ETC2_EAC_RG11 = supports(UnityEngine::TextureFormat::EAC_RG);
+    return result;
+  }();
+
+  return supported;
+}
+
+namespace {
+
+UnityEngine::Texture2D
+loadTexture2D(const CesiumGltf::ImageCesium& image, bool usePool) {
+  std::optional<UnityEngine::TextureFormat> maybeFormat =
+      getTextureFormat(image.compressedPixelFormat);
+  if (!maybeFormat) {
+    return UnityEngine::Texture2D(nullptr);
+  }
+
+  // Let Unity generate the mips of uncompressed images that don't have any
+  // yet. Mips provided with the image, whether generated in a worker thread
+  // or transcoded from KTX2, are copied along with the base level.
+  const bool isCompressed =
+      image.compressedPixelFormat != GpuCompressedPixelFormat::NONE;
+  const bool generateMips = !isCompressed && image.mipPositions.empty();
+  const int32_t mipCount =
+      generateMips ? -1
+                   : std::max(int32_t(image.mipPositions.size()), int32_t(1));
+
+  // The pool is keyed on the actual mip count, which for a full chain is one
+  // more than the log2 of the largest dimension.
+  int32_t pooledMipCount = mipCount;
+  if (generateMips) {
+    pooledMipCount = 1;
+    for (int32_t size = std::max(image.width, image.height); size > 1;
+         size /= 2) {
+      ++pooledMipCount;
+    }
+  }
+
+  UnityEngine::Texture2D result(nullptr);
+  if (usePool) {
+    result = TexturePool::acquire(
+        image.width,
+        image.height,
+        *maybeFormat,
+        pooledMipCount);
+  }
+
+  // A reused pooled texture is not readable, so its pixels are uploaded to a
+  // staging texture and copied to it on the GPU.
+  const bool useStaging = result != nullptr && !result.isReadable();
+  UnityEngine::Texture2D uploadTexture =
+      useStaging ? TexturePool::getStagingTexture(
+                       image.width,
+                       image.height,
+                       *maybeFormat,
+                       pooledMipCount)
+                 : result;
+
+  if (result == nullptr) {
+    result = UnityEngine::Texture2D(
+        image.width,
+        image.height,
+        *maybeFormat,
+        mipCount,
+        false);
+    result.hideFlags(UnityEngine::HideFlags::HideAndDontSave);
+    uploadTexture = result;
+  }
 
   Unity::Collections::NativeArray1<std::uint8_t> textureData =
-      result.GetRawTextureData<std::uint8_t>();
+      uploadTexture.GetRawTextureData<std::uint8_t>();
   std::uint8_t* pixels = static_cast<std::uint8_t*>(
       Unity::Collections::LowLevel::Unsafe::NativeArrayUnsafeUtility::
           GetUnsafeBufferPointerWithoutChecks(textureData));
@@ -38,11 +168,30 @@ TextureLoader::loadTexture(const CesiumGltf::ImageCesium& image) {
 
   std::memcpy(pixels, image.pixelData.data(), image.pixelData.size());
 
-  result.Apply(true, true);
+  // The staging texture stays readable so that it can be refilled. Pooled
+  // textures only do on devices that cannot copy textures on the GPU.
+  const bool keepReadable =
+      useStaging || (usePool && !TexturePool::canRefillUnreadableTextures());
+  uploadTexture.Apply(generateMips, !keepReadable);
+  if (useStaging) {
+    UnityEngine::Graphics::CopyTexture(uploadTexture, result);
+  }
 
   return result;
 }
 
+} // namespace
+
+UnityEngine::Texture
+TextureLoader::loadTexture(const CesiumGltf::ImageCesium& image) {
+  return loadTexture2D(image, false);
+}
+
+UnityEngine::Texture2D
+TextureLoader::loadPooledTexture(const CesiumGltf::ImageCesium& image) {
+  return loadTexture2D(image, true);
+}
+
 UnityEngine::Texture TextureLoader::loadTexture(
     const CesiumGltf::Model& model,
     std::int32_t textureIndex) {
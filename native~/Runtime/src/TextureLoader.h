@@ -6,19 +6,49 @@ namespace CesiumGltf {
 struct Model;
 struct Texture;
 struct ImageCesium;
+struct SupportedGpuCompressedPixelFormats;
 } // namespace CesiumGltf
 
 namespace DotNet::UnityEngine {
 class Texture;
-}
+class Texture2D;
+} // namespace DotNet::UnityEngine
 
 namespace CesiumForUnityNative {
 
 class TextureLoader {
 public:
+  /**
+   * @brief Gets the GPU compressed pixel formats that the current device can
+   * sample from, which KTX2 textures may be transcoded to.
+   *
+   * Must be called from the main thread.
+   */
+  static CesiumGltf::SupportedGpuCompressedPixelFormats
+  getSupportedGpuCompressedPixelFormats();
+
+  /**
+   * @brief Creates a texture from an uncompressed RGBA8 image or from an image
+   * in any GPU compressed pixel format that Unity supports, along with any
+   * mips the image has.
+   */
   static ::DotNet::UnityEngine::Texture
   loadTexture(const CesiumGltf::ImageCesium& image);
 
+  /**
+   * @brief Like {@link loadTexture}, but reuses a texture of the same size,
+   * format, and mip count from the {@link TexturePool} when one is available.
+   *
+   * The returned texture is not readable, so its CPU copy is freed once it is
+   * uploaded. When it is reused from the pool, the image is uploaded to a
+   * staging texture from {@link TexturePool::getStagingTexture} and copied
+   * into it on the GPU with `Graphics.CopyTexture`. On devices that can't copy
+   * textures, it stays readable instead so that it can be returned to the pool
+   * with {@link TexturePool::release} and refilled later.
+   */
+  static ::DotNet::UnityEngine::Texture2D
+  loadPooledTexture(const CesiumGltf::ImageCesium& image);
+
   static ::DotNet::UnityEngine::Texture
   loadTexture(const CesiumGltf::Model& model, std::int32_t textureIndex);
 
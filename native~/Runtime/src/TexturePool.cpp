@@ -0,0 +1,188 @@
+#include "TexturePool.h"
+
+#include "UnityLifetime.h"
+
+#include <DotNet/UnityEngine/CopyTextureSupport.h>
+#include <DotNet/UnityEngine/HideFlags.h>
+#include <DotNet/UnityEngine/SystemInfo.h>
+#include <DotNet/UnityEngine/Texture2D.h>
+#include <DotNet/UnityEngine/TextureFormat.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+using namespace DotNet;
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+struct TextureKey {
+  int32_t width;
+  int32_t height;
+  UnityEngine::TextureFormat format;
+  int32_t mipCount;
+
+  bool operator==(const TextureKey& rhs) const noexcept {
+    return this->width == rhs.width && this->height == rhs.height &&
+           this->format == rhs.format && this->mipCount == rhs.mipCount;
+  }
+};
+
+struct TextureKeyHash {
+  size_t operator()(const TextureKey& key) const noexcept {
+    size_t hash = std::hash<int32_t>{}(key.width);
+    hash = hash * 31 + std::hash<int32_t>{}(key.height);
+    hash = hash * 31 + std::hash<int32_t>{}(int32_t(key.format));
+    hash = hash * 31 + std::hash<int32_t>{}(key.mipCount);
+    return hash;
+  }
+};
+
+std::unordered_map<
+    TextureKey,
+    std::vector<UnityEngine::Texture2D>,
+    TextureKeyHash>
+buckets;
+std::unordered_map<TextureKey, UnityEngine::Texture2D, TextureKeyHash>
+    stagingTextures;
+int32_t pooledTextureCount = 0;
+int32_t maximumTextureCount = 0;
+int32_t maximumTexturesPerSize = 0;
+int32_t userCount = 0;
+int64_t hitCount = 0;
+int64_t missCount = 0;
+
+void trimToLimits() {
+  for (auto it = buckets.begin(); it != buckets.end();) {
+    std::vector<UnityEngine::Texture2D>& textures = it->second;
+    while (!textures.empty() &&
+           (pooledTextureCount > maximumTextureCount ||
+            int32_t(textures.size()) > maximumTexturesPerSize)) {
+      UnityLifetime::Destroy(textures.back());
+      textures.pop_back();
+      --pooledTextureCount;
+    }
+
+    if (textures.empty()) {
+      it = buckets.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+} // namespace
+
+void TexturePool::addUser() { ++userCount; }
+
+void TexturePool::removeUser() {
+  if (userCount > 0 && --userCount == 0) {
+    for (auto& [key, textures] : buckets) {
+      for (const UnityEngine::Texture2D& texture : textures) {
+        UnityLifetime::Destroy(texture);
+      }
+    }
+    buckets.clear();
+    pooledTextureCount = 0;
+
+    for (auto& [key, texture] : stagingTextures) {
+      UnityLifetime::Destroy(texture);
+    }
+    stagingTextures.clear();
+  }
+}
+
+void TexturePool::setLimits(int32_t maximumTextures, int32_t maximumPerSize) {
+  maximumTextureCount = std::max(maximumTextures, 0);
+  maximumTexturesPerSize = std::max(maximumPerSize, 0);
+  trimToLimits();
+}
+
+UnityEngine::Texture2D TexturePool::acquire(
+    int32_t width,
+    int32_t height,
+    UnityEngine::TextureFormat format,
+    int32_t mipCount) {
+  auto it = buckets.find(TextureKey{width, height, format, mipCount});
+  if (it == buckets.end() || it->second.empty()) {
+    ++missCount;
+    return UnityEngine::Texture2D(nullptr);
+  }
+
+  std::vector<UnityEngine::Texture2D>& textures = it->second;
+  UnityEngine::Texture2D result = std::move(textures.back());
+  textures.pop_back();
+  if (textures.empty()) {
+    buckets.erase(it);
+  }
+
+  --pooledTextureCount;
+  ++hitCount;
+  return result;
+}
+
+UnityEngine::Texture2D TexturePool::getStagingTexture(
+    int32_t width,
+    int32_t height,
+    UnityEngine::TextureFormat format,
+    int32_t mipCount) {
+  const TextureKey key{width, height, format, mipCount};
+  auto it = stagingTextures.find(key);
+  if (it != stagingTextures.end()) {
+    return it->second;
+  }
+
+  UnityEngine::Texture2D texture(width, height, format, mipCount, false);
+  texture.hideFlags(UnityEngine::HideFlags::HideAndDontSave);
+  if (userCount > 0) {
+    stagingTextures.emplace(key, texture);
+  }
+  return texture;
+}
+
+bool TexturePool::canRefillUnreadableTextures() {
+  // What the device supports does not change, so only ask Unity once.
+  static const bool canCopy = UnityEngine::SystemInfo::copyTextureSupport() !=
+                              UnityEngine::CopyTextureSupport::None;
+  return canCopy;
+}
+
+void TexturePool::release(const UnityEngine::Texture2D& texture) {
+  if (texture == nullptr) {
+    return;
+  }
+
+  if (userCount == 0 || pooledTextureCount >= maximumTextureCount ||
+      (!texture.isReadable() && !canRefillUnreadableTextures())) {
+    UnityLifetime::Destroy(texture);
+    return;
+  }
+
+  std::vector<UnityEngine::Texture2D>& textures = buckets[TextureKey{
+      texture.width(),
+      texture.height(),
+      texture.format(),
+      texture.mipmapCount()}];
+  if (int32_t(textures.size()) >= maximumTexturesPerSize) {
+    UnityLifetime::Destroy(texture);
+    return;
+  }
+
+  textures.emplace_back(texture);
+  ++pooledTextureCount;
+}
+
+int64_t TexturePool::getHitCount() { return hitCount; }
+
+int64_t TexturePool::getMissCount() { return missCount; }
+
+int32_t TexturePool::getPooledTextureCount() { return pooledTextureCount; }
+
+void TexturePool::resetStatistics() {
+  hitCount = 0;
+  missCount = 0;
+}
+
+} // namespace CesiumForUnityNative
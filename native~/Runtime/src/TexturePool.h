@@ -0,0 +1,106 @@
+#pragma once
+
+#include <DotNet/UnityEngine/Texture2D.h>
+#include <DotNet/UnityEngine/TextureFormat.h>
+
+#include <cstdint>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief A pool of textures that are no longer in use, bucketed by size,
+ * format, and mip count.
+ *
+ * Raster overlay tiles are loaded and unloaded constantly as the camera
+ * moves, and nearly all of them have the same few sizes. Rather than
+ * destroying the texture of an unloaded raster tile and creating a new one for
+ * the next, its texture is kept here and refilled with the new pixels.
+ *
+ * Pooled textures are not readable, so they don't keep a CPU copy of their
+ * pixels while they are in use. A reused texture is refilled by uploading the
+ * new pixels to a readable staging texture of the same size and format, and
+ * copying that to the pooled texture on the GPU. Only one staging texture is
+ * kept per size and format. On devices that cannot copy textures, pooled
+ * textures are kept readable and refilled directly instead.
+ *
+ * All functions must be called from the main thread.
+ */
+class TexturePool {
+public:
+  /**
+   * @brief Registers a user of the pool. The pool is only kept alive while it
+   * has at least one user.
+   */
+  static void addUser();
+
+  /**
+   * @brief Unregisters a user of the pool. When the last user is removed, all
+   * pooled textures are destroyed.
+   */
+  static void removeUser();
+
+  /**
+   * @brief Sets the maximum number of textures kept in the pool in total and
+   * for any one size and format, destroying pooled textures over the new
+   * limits.
+   */
+  static void setLimits(int32_t maximumTextures, int32_t maximumPerSize);
+
+  /**
+   * @brief Takes a texture with the given size, format, and mip count from the
+   * pool.
+   *
+   * @returns The texture, or a null texture if the pool has none that match.
+   */
+  static ::DotNet::UnityEngine::Texture2D acquire(
+      int32_t width,
+      int32_t height,
+      ::DotNet::UnityEngine::TextureFormat format,
+      int32_t mipCount);
+
+  /**
+   * @brief Gets the readable texture used to refill pooled textures with the
+   * given size, format, and mip count, creating it if necessary.
+   *
+   * Its contents are only valid until the next refill.
+   */
+  static ::DotNet::UnityEngine::Texture2D getStagingTexture(
+      int32_t width,
+      int32_t height,
+      ::DotNet::UnityEngine::TextureFormat format,
+      int32_t mipCount);
+
+  /**
+   * @brief Determines whether pooled textures can be refilled with a GPU copy
+   * from a staging texture, and so do not need to be readable.
+   */
+  static bool canRefillUnreadableTextures();
+
+  /**
+   * @brief Returns a texture to the pool, or destroys it if the pool is full,
+   * has no users, or the texture cannot be refilled.
+   */
+  static void release(const ::DotNet::UnityEngine::Texture2D& texture);
+
+  /**
+   * @brief Gets the number of times {@link acquire} found a matching texture.
+   */
+  static int64_t getHitCount();
+
+  /**
+   * @brief Gets the number of times {@link acquire} found no matching texture.
+   */
+  static int64_t getMissCount();
+
+  /**
+   * @brief Gets the number of textures currently in the pool.
+   */
+  static int32_t getPooledTextureCount();
+
+  /**
+   * @brief Resets the hit and miss counts to zero.
+   */
+  static void resetStatistics();
+};
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,388 @@
+#include "TilePack.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+constexpr char magic[8] = {'C', 'E', 'S', 'I', 'U', 'M', 'T', 'P'};
+constexpr uint32_t version = 1;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t entryCount;
+  uint64_t indexOffset;
+  uint64_t reserved;
+};
+
+struct IndexRecord {
+  uint64_t dataOffset;
+  uint64_t dataSize;
+  uint64_t keyOffset;
+  uint32_t keyLength;
+  uint16_t contentTypeLength;
+  uint16_t statusCode;
+};
+
+static_assert(sizeof(Header) == 32, "Tile pack header must be 32 bytes");
+static_assert(sizeof(IndexRecord) == 32, "Tile pack record must be 32 bytes");
+
+IndexRecord readRecord(const std::byte* pIndex, size_t index) {
+  IndexRecord record;
+  std::memcpy(&record, pIndex + index * sizeof(IndexRecord), sizeof(record));
+  return record;
+}
+
+bool isWithin(uint64_t offset, uint64_t size, size_t fileSize) {
+  return offset <= fileSize && size <= fileSize - offset;
+}
+
+} // namespace
+
+std::string createTilePackKey(const std::string& url) {
+  const size_t queryStart = url.find('?');
+  if (queryStart == std::string::npos) {
+    return url;
+  }
+
+  size_t queryEnd = url.find('#', queryStart);
+  if (queryEnd == std::string::npos) {
+    queryEnd = url.size();
+  }
+
+  std::string key = url.substr(0, queryStart);
+  char separator = '?';
+
+  size_t parameterStart = queryStart + 1;
+  while (parameterStart < queryEnd) {
+    size_t parameterEnd = url.find('&', parameterStart);
+    if (parameterEnd == std::string::npos || parameterEnd > queryEnd) {
+      parameterEnd = queryEnd;
+    }
+
+    std::string_view parameter(
+        url.data() + parameterStart,
+        parameterEnd - parameterStart);
+    if (!parameter.empty() && parameter.rfind("access_token=", 0) != 0) {
+      key += separator;
+      key += parameter;
+      separator = '&';
+    }
+
+    parameterStart = parameterEnd + 1;
+  }
+
+  return key;
+}
+
+std::shared_ptr<TilePackReader> TilePackReader::open(const std::string& path) {
+  std::shared_ptr<TilePackReader> pReader(new TilePackReader());
+  pReader->_path = path;
+
+#if defined(_WIN32)
+  const int wideLength =
+      MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, nullptr, 0);
+  std::wstring widePath(size_t(std::max(wideLength, 1)), L'\0');
+  MultiByteToWideChar(
+      CP_UTF8,
+      0,
+      path.c_str(),
+      -1,
+      widePath.data(),
+      wideLength);
+
+  HANDLE file = CreateFileW(
+      widePath.c_str(),
+      GENERIC_READ,
+      FILE_SHARE_READ,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+  pReader->_fileHandle = file;
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize) ||
+      uint64_t(fileSize.QuadPart) < sizeof(Header)) {
+    return nullptr;
+  }
+
+  HANDLE mapping =
+      CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr) {
+    return nullptr;
+  }
+  pReader->_mappingHandle = mapping;
+
+  void* pView = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (pView == nullptr) {
+    return nullptr;
+  }
+
+  pReader->_pFile = static_cast<const std::byte*>(pView);
+  pReader->_fileSize = size_t(fileSize.QuadPart);
+#else
+  const int file = ::open(path.c_str(), O_RDONLY);
+  if (file < 0) {
+    return nullptr;
+  }
+
+  struct stat fileStat;
+  if (fstat(file, &fileStat) != 0 ||
+      uint64_t(fileStat.st_size) < sizeof(Header)) {
+    close(file);
+    return nullptr;
+  }
+
+  void* pMapping =
+      mmap(nullptr, size_t(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+  close(file);
+  if (pMapping == MAP_FAILED) {
+    return nullptr;
+  }
+
+  pReader->_pFile = static_cast<const std::byte*>(pMapping);
+  pReader->_fileSize = size_t(fileStat.st_size);
+#endif
+
+  Header header;
+  std::memcpy(&header, pReader->_pFile, sizeof(header));
+  if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 ||
+      header.version != version ||
+      !isWithin(
+          header.indexOffset,
+          uint64_t(header.entryCount) * sizeof(IndexRecord),
+          pReader->_fileSize)) {
+    return nullptr;
+  }
+
+  pReader->_pIndex = pReader->_pFile + header.indexOffset;
+  pReader->_entryCount = header.entryCount;
+
+  // Validate every record up front, so that lookups don't need to.
+  for (uint32_t i = 0; i < header.entryCount; ++i) {
+    IndexRecord record = readRecord(pReader->_pIndex, i);
+    if (!isWithin(record.dataOffset, record.dataSize, pReader->_fileSize) ||
+        !isWithin(
+            record.keyOffset,
+            uint64_t(record.keyLength) + record.contentTypeLength,
+            pReader->_fileSize)) {
+      return nullptr;
+    }
+  }
+
+  return pReader;
+}
+
+TilePackReader::~TilePackReader() {
+#if defined(_WIN32)
+  if (this->_pFile) {
+    UnmapViewOfFile(this->_pFile);
+  }
+  if (this->_mappingHandle) {
+    CloseHandle(this->_mappingHandle);
+  }
+  if (this->_fileHandle) {
+    CloseHandle(this->_fileHandle);
+  }
+#else
+  if (this->_pFile) {
+    munmap(const_cast<std::byte*>(this->_pFile), this->_fileSize);
+  }
+#endif
+}
+
+std::optional<TilePackEntry> TilePackReader::find(std::string_view key) const {
+  const char* pChars = reinterpret_cast<const char*>(this->_pFile);
+
+  size_t first = 0;
+  size_t last = this->_entryCount;
+  while (first < last) {
+    const size_t middle = first + (last - first) / 2;
+    const IndexRecord record = readRecord(this->_pIndex, middle);
+    std::string_view recordKey(pChars + record.keyOffset, record.keyLength);
+
+    const int comparison = recordKey.compare(key);
+    if (comparison < 0) {
+      first = middle + 1;
+    } else if (comparison > 0) {
+      last = middle;
+    } else {
+      return TilePackEntry{
+          record.statusCode,
+          std::string_view(
+              pChars + record.keyOffset + record.keyLength,
+              record.contentTypeLength),
+          this->_pFile + record.dataOffset,
+          size_t(record.dataSize)};
+    }
+  }
+
+  return std::nullopt;
+}
+
+TilePackWriter::TilePackWriter(const std::string& path)
+    : _path(path),
+      _temporaryPath(path + ".tmp"),
+      _mutex(),
+      _stream(),
+      _offset(0),
+      _failed(false),
+      _finished(false),
+      _entries(),
+      _keys() {}
+
+std::unique_ptr<TilePackWriter>
+TilePackWriter::create(const std::string& path) {
+  std::unique_ptr<TilePackWriter> pWriter(new TilePackWriter(path));
+  pWriter->_stream.open(
+      pWriter->_temporaryPath,
+      std::ios::binary | std::ios::out | std::ios::trunc);
+  if (!pWriter->_stream) {
+    return nullptr;
+  }
+
+  // The header is written for real once the index is.
+  Header header{};
+  if (!pWriter->writeBytes(&header, sizeof(header))) {
+    return nullptr;
+  }
+
+  return pWriter;
+}
+
+TilePackWriter::~TilePackWriter() {
+  if (!this->_finished) {
+    this->_stream.close();
+    std::remove(this->_temporaryPath.c_str());
+  }
+}
+
+bool TilePackWriter::add(
+    const std::string& key,
+    uint16_t statusCode,
+    const std::string& contentType,
+    const std::byte* pData,
+    size_t dataSize) {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  if (this->_finished || this->_failed ||
+      key.size() > std::numeric_limits<uint32_t>::max() ||
+      contentType.size() > std::numeric_limits<uint16_t>::max() ||
+      !this->_keys.insert(key).second) {
+    return false;
+  }
+
+  PendingEntry entry{
+      key,
+      this->_offset,
+      this->_offset + key.size() + contentType.size(),
+      dataSize,
+      statusCode,
+      uint16_t(contentType.size())};
+
+  if (!this->writeBytes(key.data(), key.size()) ||
+      !this->writeBytes(contentType.data(), contentType.size()) ||
+      !this->writeBytes(pData, dataSize)) {
+    return false;
+  }
+
+  this->_entries.emplace_back(std::move(entry));
+  return true;
+}
+
+bool TilePackWriter::finish() {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  if (this->_finished) {
+    return !this->_failed;
+  }
+
+  std::sort(
+      this->_entries.begin(),
+      this->_entries.end(),
+      [](const PendingEntry& lhs, const PendingEntry& rhs) {
+        return lhs.key < rhs.key;
+      });
+
+  Header header{};
+  std::memcpy(header.magic, magic, sizeof(magic));
+  header.version = version;
+  header.entryCount = uint32_t(this->_entries.size());
+  header.indexOffset = this->_offset;
+
+  for (const PendingEntry& entry : this->_entries) {
+    IndexRecord record{
+        entry.dataOffset,
+        entry.dataSize,
+        entry.keyOffset,
+        uint32_t(entry.key.size()),
+        entry.contentTypeLength,
+        entry.statusCode};
+    if (!this->writeBytes(&record, sizeof(record))) {
+      break;
+    }
+  }
+
+  if (!this->_failed) {
+    this->_stream.seekp(0);
+    this->writeBytes(&header, sizeof(header));
+  }
+
+  this->_stream.close();
+  this->_finished = true;
+
+  if (this->_failed || !this->_stream) {
+    this->_failed = true;
+    std::remove(this->_temporaryPath.c_str());
+    return false;
+  }
+
+  // rename doesn't replace an existing file on every platform.
+  std::remove(this->_path.c_str());
+  if (std::rename(this->_temporaryPath.c_str(), this->_path.c_str()) != 0) {
+    this->_failed = true;
+    std::remove(this->_temporaryPath.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+int32_t TilePackWriter::getEntryCount() const {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  return int32_t(this->_entries.size());
+}
+
+bool TilePackWriter::writeBytes(const void* pData, size_t size) {
+  if (size > 0) {
+    this->_stream.write(
+        static_cast<const char*>(pData),
+        std::streamsize(size));
+  }
+  if (!this->_stream) {
+    this->_failed = true;
+    return false;
+  }
+  this->_offset += size;
+  return true;
+}
+
+} // namespace CesiumForUnityNative
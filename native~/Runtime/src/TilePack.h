@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief Creates the key that a response for the given URL is stored under in
+ * a tile pack.
+ *
+ * The key is the URL without any `access_token` query parameters, because
+ * Cesium ion tokens change from session to session while the assets they
+ * grant access to do not.
+ */
+std::string createTilePackKey(const std::string& url);
+
+/**
+ * @brief A response stored in a tile pack.
+ */
+struct TilePackEntry {
+  uint16_t statusCode;
+  std::string_view contentType;
+  const std::byte* pData;
+  size_t dataSize;
+};
+
+/**
+ * @brief Reads a tile pack: a single file holding the responses for a set of
+ * tiles and other assets, indexed by key.
+ *
+ * The file is memory-mapped, so looking up an entry only reads the pages of
+ * the index it touches, and the data of an entry points directly into the
+ * mapping instead of being copied. Entries stay valid for as long as the
+ * reader does.
+ *
+ * A tile pack file starts with a 32-byte header: the eight bytes "CESIUMTP",
+ * a uint32 version, a uint32 entry count, a uint64 index offset, and eight
+ * reserved bytes. The index is an array of fixed-size records sorted by key,
+ * each with the offset and size of the entry's data, the offset and length of
+ * its key, immediately followed by its content type, the length of the
+ * content type, and its status code. All values are little-endian.
+ *
+ * All functions may be called from any thread.
+ */
+class TilePackReader {
+public:
+  /**
+   * @brief Opens and maps a tile pack.
+   *
+   * @returns The reader, or nullptr if the file could not be mapped or is not
+   * a valid tile pack.
+   */
+  static std::shared_ptr<TilePackReader> open(const std::string& path);
+
+  ~TilePackReader();
+
+  TilePackReader(const TilePackReader&) = delete;
+  TilePackReader& operator=(const TilePackReader&) = delete;
+
+  /**
+   * @brief Finds the entry with the given key.
+   */
+  std::optional<TilePackEntry> find(std::string_view key) const;
+
+  uint32_t getEntryCount() const noexcept { return this->_entryCount; }
+
+  /**
+   * @brief Gets the path the tile pack was opened from.
+   */
+  const std::string& getPath() const noexcept { return this->_path; }
+
+private:
+  TilePackReader() = default;
+
+  std::string _path;
+  const std::byte* _pFile = nullptr;
+  size_t _fileSize = 0;
+  const std::byte* _pIndex = nullptr;
+  uint32_t _entryCount = 0;
+#ifdef _WIN32
+  void* _fileHandle = nullptr;
+  void* _mappingHandle = nullptr;
+#endif
+};
+
+/**
+ * @brief Writes a tile pack that can be read with {@link TilePackReader}.
+ *
+ * Entries are appended to a temporary file next to the destination as they
+ * are added. {@link finish} writes the index and moves the file into place,
+ * so a pack being written never replaces an existing one until it is
+ * complete.
+ *
+ * All functions may be called from any thread.
+ */
+class TilePackWriter {
+public:
+  /**
+   * @brief Starts writing a tile pack to the given path.
+   *
+   * @returns The writer, or nullptr if the temporary file could not be
+   * created.
+   */
+  static std::unique_ptr<TilePackWriter> create(const std::string& path);
+
+  /**
+   * @brief Discards the pack if {@link finish} was not called.
+   */
+  ~TilePackWriter();
+
+  TilePackWriter(const TilePackWriter&) = delete;
+  TilePackWriter& operator=(const TilePackWriter&) = delete;
+
+  /**
+   * @brief Adds an entry to the pack.
+   *
+   * @returns true if the entry was added, or false if an entry with the same
+   * key was already added or the file could not be written.
+   */
+  bool add(
+      const std::string& key,
+      uint16_t statusCode,
+      const std::string& contentType,
+      const std::byte* pData,
+      size_t dataSize);
+
+  /**
+   * @brief Writes the index and moves the pack to its destination. No more
+   * entries can be added afterward.
+   *
+   * @returns true if the pack was written successfully.
+   */
+  bool finish();
+
+  int32_t getEntryCount() const;
+
+private:
+  struct PendingEntry {
+    std::string key;
+    uint64_t keyOffset;
+    uint64_t dataOffset;
+    uint64_t dataSize;
+    uint16_t statusCode;
+    uint16_t contentTypeLength;
+  };
+
+  TilePackWriter(const std::string& path);
+
+  bool writeBytes(const void* pData, size_t size);
+
+  std::string _path;
+  std::string _temporaryPath;
+  mutable std::mutex _mutex;
+  std::ofstream _stream;
+  uint64_t _offset;
+  bool _failed;
+  bool _finished;
+  std::vector<PendingEntry> _entries;
+  std::unordered_set<std::string> _keys;
+};
+
+} // namespace CesiumForUnityNative
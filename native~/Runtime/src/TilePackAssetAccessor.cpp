@@ -0,0 +1,251 @@
+#include "TilePackAssetAccessor.h"
+
+#include "TilePack.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+#include <system_error>
+
+using namespace CesiumAsync;
+
+namespace {
+
+using namespace CesiumForUnityNative;
+
+class TilePackAssetResponse : public IAssetResponse {
+public:
+  TilePackAssetResponse(
+      const std::shared_ptr<TilePackReader>& pReader,
+      const TilePackEntry& entry)
+      : _pReader(pReader),
+        _statusCode(entry.statusCode),
+        _contentType(entry.contentType),
+        _headers(),
+        _data(entry.pData, entry.dataSize) {
+    if (!this->_contentType.empty()) {
+      this->_headers.emplace("Content-Type", this->_contentType);
+    }
+  }
+
+  virtual uint16_t statusCode() const override { return _statusCode; }
+
+  virtual std::string contentType() const override { return _contentType; }
+
+  virtual const HttpHeaders& headers() const override { return _headers; }
+
+  virtual gsl::span<const std::byte> data() const override {
+    return this->_data;
+  }
+
+private:
+  // Keeps the mapping that _data points into alive.
+  std::shared_ptr<TilePackReader> _pReader;
+  uint16_t _statusCode;
+  std::string _contentType;
+  HttpHeaders _headers;
+  gsl::span<const std::byte> _data;
+};
+
+class TilePackAssetRequest : public IAssetRequest {
+public:
+  TilePackAssetRequest(
+      const std::string& url,
+      const std::vector<IAssetAccessor::THeader>& headers,
+      const std::shared_ptr<TilePackReader>& pReader,
+      const TilePackEntry& entry)
+      : _method("GET"),
+        _url(url),
+        _headers(headers.begin(), headers.end()),
+        _response(pReader, entry) {}
+
+  virtual const std::string& method() const override { return _method; }
+
+  virtual const std::string& url() const override { return _url; }
+
+  virtual const HttpHeaders& headers() const override { return _headers; }
+
+  virtual const IAssetResponse* response() const override { return &_response; }
+
+private:
+  std::string _method;
+  std::string _url;
+  HttpHeaders _headers;
+  TilePackAssetResponse _response;
+};
+
+void record(
+    TilePackWriter& writer,
+    const std::string& key,
+    const IAssetRequest& request) {
+  const IAssetResponse* pResponse = request.response();
+  if (!pResponse || pResponse->statusCode() < 200 ||
+      pResponse->statusCode() >= 300) {
+    return;
+  }
+
+  gsl::span<const std::byte> data = pResponse->data();
+  writer.add(
+      key,
+      pResponse->statusCode(),
+      pResponse->contentType(),
+      data.data(),
+      data.size());
+}
+
+} // namespace
+
+namespace CesiumForUnityNative {
+
+TilePackAssetAccessor::TilePackAssetAccessor(
+    const std::shared_ptr<IAssetAccessor>& pAccessor,
+    const std::shared_ptr<TilePackReader>& pReader)
+    : _pAccessor(pAccessor),
+      _pReader(pReader),
+      _writerMutex(),
+      _pWriter(),
+      _hitCount(0),
+      _missCount(0) {}
+
+Future<std::shared_ptr<IAssetRequest>> TilePackAssetAccessor::get(
+    const AsyncSystem& asyncSystem,
+    const std::string& url,
+    const std::vector<THeader>& headers) {
+  std::string key = createTilePackKey(url);
+  std::shared_ptr<TilePackWriter> pWriter = this->getWriter();
+
+  if (this->_pReader) {
+    std::optional<TilePackEntry> maybeEntry = this->_pReader->find(key);
+    if (maybeEntry) {
+      ++this->_hitCount;
+      auto pRequest = std::make_shared<TilePackAssetRequest>(
+          url,
+          headers,
+          this->_pReader,
+          *maybeEntry);
+      if (!pWriter) {
+        return asyncSystem.createResolvedFuture<std::shared_ptr<IAssetRequest>>(
+            std::move(pRequest));
+      }
+
+      // Hits are served on whichever thread asks for them, which may be the
+      // main thread, so write them to the pack in a worker thread as well.
+      return asyncSystem.runInWorkerThread(
+          [pWriter, key = std::move(key), pRequest = std::move(pRequest)]()
+              -> std::shared_ptr<IAssetRequest> {
+            record(*pWriter, key, *pRequest);
+            return pRequest;
+          });
+    }
+
+    ++this->_missCount;
+  }
+
+  Future<std::shared_ptr<IAssetRequest>> future =
+      this->_pAccessor->get(asyncSystem, url, headers);
+  if (!pWriter) {
+    return future;
+  }
+
+  // Downloads may complete on the main thread, so write them to the pack in a
+  // worker thread instead.
+  return std::move(future).thenInWorkerThread(
+      [pWriter, key = std::move(key)](
+          std::shared_ptr<IAssetRequest>&& pRequest) {
+        if (pRequest) {
+          record(*pWriter, key, *pRequest);
+        }
+        return std::move(pRequest);
+      });
+}
+
+Future<std::shared_ptr<IAssetRequest>> TilePackAssetAccessor::request(
+    const AsyncSystem& asyncSystem,
+    const std::string& verb,
+    const std::string& url,
+    const std::vector<THeader>& headers,
+    const gsl::span<const std::byte>& contentPayload) {
+  if (verb == "GET" && contentPayload.empty()) {
+    return this->get(asyncSystem, url, headers);
+  }
+  return this->_pAccessor
+      ->request(asyncSystem, verb, url, headers, contentPayload);
+}
+
+void TilePackAssetAccessor::tick() noexcept { this->_pAccessor->tick(); }
+
+bool TilePackAssetAccessor::startRecording(const std::string& path) {
+  // Finishing the new pack would replace the mapped one, which fails on
+  // Windows and elsewhere would pull the data out from under the responses
+  // that point into it.
+  if (this->_pReader) {
+    std::error_code error;
+    const bool isServedPack = std::filesystem::equivalent(
+        std::filesystem::u8path(path),
+        std::filesystem::u8path(this->_pReader->getPath()),
+        error);
+    if (isServedPack) {
+      SPDLOG_LOGGER_WARN(
+          spdlog::default_logger(),
+          "Can't record a tile pack to {}, because it is the tile pack being "
+          "used. Record to a different path instead.",
+          path);
+      return false;
+    }
+  }
+
+  std::shared_ptr<TilePackWriter> pWriter = TilePackWriter::create(path);
+
+  std::lock_guard<std::mutex> lock(this->_writerMutex);
+  this->_pWriter = std::move(pWriter);
+  return this->_pWriter != nullptr;
+}
+
+bool TilePackAssetAccessor::stopRecording() {
+  std::shared_ptr<TilePackWriter> pWriter;
+  {
+    std::lock_guard<std::mutex> lock(this->_writerMutex);
+    pWriter = std::move(this->_pWriter);
+  }
+
+  // Responses still being recorded in a worker thread are either added before
+  // this or rejected by the finished writer.
+  return pWriter && pWriter->finish();
+}
+
+bool TilePackAssetAccessor::isRecording() const {
+  return this->getWriter() != nullptr;
+}
+
+int32_t TilePackAssetAccessor::getRecordedEntryCount() const {
+  std::shared_ptr<TilePackWriter> pWriter = this->getWriter();
+  return pWriter ? pWriter->getEntryCount() : 0;
+}
+
+int32_t TilePackAssetAccessor::getEntryCount() const noexcept {
+  return this->_pReader ? int32_t(this->_pReader->getEntryCount()) : 0;
+}
+
+int64_t TilePackAssetAccessor::getHitCount() const noexcept {
+  return this->_hitCount;
+}
+
+int64_t TilePackAssetAccessor::getMissCount() const noexcept {
+  return this->_missCount;
+}
+
+void TilePackAssetAccessor::resetStatistics() noexcept {
+  this->_hitCount = 0;
+  this->_missCount = 0;
+}
+
+std::shared_ptr<TilePackWriter> TilePackAssetAccessor::getWriter() const {
+  std::lock_guard<std::mutex> lock(this->_writerMutex);
+  return this->_pWriter;
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <CesiumAsync/IAssetAccessor.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace CesiumForUnityNative {
+
+class TilePackReader;
+class TilePackWriter;
+
+/**
+ * @brief An asset accessor that serves GET requests from a tile pack when it
+ * has them, and otherwise passes them to the accessor it wraps.
+ *
+ * Responses from the pack point directly into its memory mapping, so nothing
+ * is copied or read from the network. While recording, every successful GET
+ * response, whether from the pack or from the wrapped accessor, is also added
+ * to a new tile pack, which is how packs are built: load the tilesets and
+ * raster overlays for a region and move the cameras over it at the levels of
+ * detail that should be available offline.
+ */
+class TilePackAssetAccessor : public CesiumAsync::IAssetAccessor {
+public:
+  /**
+   * @brief Creates an accessor.
+   *
+   * @param pAccessor The accessor used for requests the pack can't serve.
+   * @param pReader The tile pack to serve from, or nullptr to only pass
+   * requests through.
+   */
+  TilePackAssetAccessor(
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAccessor,
+      const std::shared_ptr<TilePackReader>& pReader);
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  get(const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& url,
+      const std::vector<THeader>& headers = {}) override;
+
+  virtual CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
+  request(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::string& verb,
+      const std::string& url,
+      const std::vector<THeader>& headers = std::vector<THeader>(),
+      const gsl::span<const std::byte>& contentPayload = {}) override;
+
+  virtual void tick() noexcept override;
+
+  /**
+   * @brief Starts adding successful GET responses to a new tile pack at the
+   * given path. Any recording in progress is discarded.
+   *
+   * The path can't be that of the tile pack being served, because the pack
+   * can't be replaced while it is mapped.
+   *
+   * @returns true if the pack was created, or false if it could not be or the
+   * path is that of the pack being served.
+   */
+  bool startRecording(const std::string& path);
+
+  /**
+   * @brief Finishes the tile pack being recorded. Responses that arrive
+   * afterward are not added to it.
+   *
+   * @returns true if a pack was being recorded and was written successfully.
+   */
+  bool stopRecording();
+
+  bool isRecording() const;
+
+  int32_t getRecordedEntryCount() const;
+
+  /**
+   * @brief Gets the number of entries in the tile pack being served, or 0 if
+   * there is none.
+   */
+  int32_t getEntryCount() const noexcept;
+
+  /**
+   * @brief Gets the number of GET requests served from the tile pack.
+   */
+  int64_t getHitCount() const noexcept;
+
+  /**
+   * @brief Gets the number of GET requests that the tile pack did not have.
+   */
+  int64_t getMissCount() const noexcept;
+
+  void resetStatistics() noexcept;
+
+private:
+  std::shared_ptr<TilePackWriter> getWriter() const;
+
+  std::shared_ptr<CesiumAsync::IAssetAccessor> _pAccessor;
+  std::shared_ptr<TilePackReader> _pReader;
+
+  mutable std::mutex _writerMutex;
+  std::shared_ptr<TilePackWriter> _pWriter;
+
+  std::atomic<int64_t> _hitCount;
+  std::atomic<int64_t> _missCount;
+};
+
+} // namespace CesiumForUnityNative
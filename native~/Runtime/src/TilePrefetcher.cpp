@@ -0,0 +1,113 @@
+#include "TilePrefetcher.h"
+
+#include <Cesium3DTilesSelection/Tile.h>
+#include <Cesium3DTilesSelection/ViewUpdateResult.h>
+
+#include <glm/geometric.hpp>
+
+using namespace Cesium3DTilesSelection;
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+// How much of each new velocity sample is blended into the smoothed velocity.
+// Lower values make the prediction steadier but slower to follow turns.
+constexpr double VELOCITY_SMOOTHING = 0.25;
+
+// Cameras predicted to move less than this many meters are not given a
+// predicted view, because it would select the same tiles as the real one.
+constexpr double MINIMUM_PREDICTED_DISTANCE = 1.0;
+
+bool isVisibleFromAnyView(
+    const std::vector<ViewState>& viewStates,
+    const Tile& tile) {
+  for (const ViewState& viewState : viewStates) {
+    if (viewState.isBoundingVolumeVisible(tile.getBoundingVolume())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+std::vector<ViewState> TilePrefetcher::addPredictedViews(
+    const std::vector<ViewState>& viewStates,
+    double deltaTime,
+    double lookAheadTime) {
+  std::vector<ViewState> result = viewStates;
+
+  if (this->_previousPositions.size() != viewStates.size()) {
+    this->_previousPositions.clear();
+    this->_velocities.assign(viewStates.size(), glm::dvec3(0.0));
+  }
+
+  for (size_t i = 0; i < viewStates.size(); ++i) {
+    const ViewState& viewState = viewStates[i];
+    const glm::dvec3& position = viewState.getPosition();
+
+    if (!this->_previousPositions.empty() && deltaTime > 0.0) {
+      glm::dvec3 velocity =
+          (position - this->_previousPositions[i]) / deltaTime;
+      this->_velocities[i] = glm::mix(
+          this->_velocities[i],
+          velocity,
+          VELOCITY_SMOOTHING);
+    }
+
+    glm::dvec3 offset = this->_velocities[i] * lookAheadTime;
+    if (glm::length(offset) < MINIMUM_PREDICTED_DISTANCE) {
+      continue;
+    }
+
+    result.emplace_back(ViewState::create(
+        position + offset,
+        viewState.getDirection(),
+        viewState.getUp(),
+        viewState.getViewportSize(),
+        viewState.getHorizontalFieldOfView(),
+        viewState.getVerticalFieldOfView()));
+  }
+
+  this->_previousPositions.resize(viewStates.size());
+  for (size_t i = 0; i < viewStates.size(); ++i) {
+    this->_previousPositions[i] = viewStates[i].getPosition();
+  }
+
+  return result;
+}
+
+void TilePrefetcher::updateStatistics(
+    const std::vector<ViewState>& viewStates,
+    const ViewUpdateResult& updateResult) {
+  std::unordered_set<const Tile*> prefetchedTiles;
+  for (const Tile* pTile : updateResult.tilesToRenderThisFrame) {
+    if (pTile->getState() != TileLoadState::Done) {
+      continue;
+    }
+
+    const bool wasPrefetched = this->_prefetchedTiles.erase(pTile) > 0;
+    if (isVisibleFromAnyView(viewStates, *pTile)) {
+      if (wasPrefetched) {
+        ++this->_hitCount;
+      }
+    } else {
+      prefetchedTiles.insert(pTile);
+    }
+  }
+
+  // What is left was prefetched but is no longer rendered, so it was never
+  // seen. Those tiles may have been unloaded since, so they are only ever
+  // compared, never dereferenced, and are dropped here.
+  this->_wasteCount += int64_t(this->_prefetchedTiles.size());
+  this->_prefetchedTiles = std::move(prefetchedTiles);
+}
+
+void TilePrefetcher::reset() {
+  this->_previousPositions.clear();
+  this->_velocities.clear();
+  this->_prefetchedTiles.clear();
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Cesium3DTilesSelection/ViewState.h>
+
+#include <glm/vec3.hpp>
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace Cesium3DTilesSelection {
+class Tile;
+struct ViewUpdateResult;
+} // namespace Cesium3DTilesSelection
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief Predicts where each camera will be a short time from now, so that a
+ * tileset can start loading the tiles needed there before they are visible.
+ *
+ * The prediction extrapolates the smoothed velocity of each camera. The
+ * predicted views are passed to the tileset along with the real ones, so
+ * tiles that are only needed by a predicted view are loaded and rendered,
+ * although Unity culls them until they come into view.
+ */
+class TilePrefetcher {
+public:
+  /**
+   * @brief Appends a predicted view for each moving camera.
+   *
+   * @param viewStates The views of the cameras this frame. They must be in the
+   * same order every frame; if the number of views changes, the cameras'
+   * velocities are reset.
+   * @param deltaTime The time since the previous frame, in seconds.
+   * @param lookAheadTime How far ahead to predict, in seconds.
+   * @returns The real views followed by the predicted ones.
+   */
+  std::vector<Cesium3DTilesSelection::ViewState> addPredictedViews(
+      const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+      double deltaTime,
+      double lookAheadTime);
+
+  /**
+   * @brief Updates the prefetch hit and waste counts from the result of a
+   * tileset update.
+   *
+   * A rendered tile that none of the real views can see is counted as
+   * prefetched. It is a hit if a real view sees it before it stops being
+   * rendered, and wasted otherwise. Only tiles that are still rendered are
+   * remembered from one update to the next.
+   *
+   * @param viewStates The views of the cameras, without predicted views.
+   * @param updateResult The result of updating the tileset with the real and
+   * predicted views.
+   */
+  void updateStatistics(
+      const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+      const Cesium3DTilesSelection::ViewUpdateResult& updateResult);
+
+  /**
+   * @brief Forgets the camera velocities and the prefetched tiles. This must
+   * be called when the tileset is destroyed.
+   */
+  void reset();
+
+  int64_t getHitCount() const { return this->_hitCount; }
+  int64_t getWasteCount() const { return this->_wasteCount; }
+
+private:
+  std::vector<glm::dvec3> _previousPositions;
+  std::vector<glm::dvec3> _velocities;
+  std::unordered_set<const Cesium3DTilesSelection::Tile*> _prefetchedTiles;
+  int64_t _hitCount = 0;
+  int64_t _wasteCount = 0;
+};
+
+} // namespace CesiumForUnityNative
@@ -1,6 +1,10 @@
 #include "UnityPrepareRendererResources.h"
 
+#include "ImageProcessing.h"
+#include "MaterialCache.h"
+#include "MeshDataArrayPool.h"
 #include "TextureLoader.h"
+#include "TexturePool.h"
 #include "UnityLifetime.h"
 #include "UnityTransforms.h"
 
@@ -13,6 +17,7 @@
 #include <CesiumGltf/ExtensionKhrMaterialsUnlit.h>
 #include <CesiumGltf/ExtensionMeshPrimitiveExtFeatureMetadata.h>
 #include <CesiumGltf/ExtensionModelExtFeatureMetadata.h>
+#include <CesiumGltf/Ktx2TranscodeTargets.h>
 #include <CesiumShaderProperties.h>
 #include <CesiumUtility/ScopeGuard.h>
 
@@ -20,18 +25,20 @@
 #include <DotNet/CesiumForUnity/CesiumGeoreference.h>
 #include <DotNet/CesiumForUnity/CesiumGlobeAnchor.h>
 #include <DotNet/CesiumForUnity/CesiumMetadata.h>
+#include <DotNet/CesiumForUnity/Helpers.h>
 #include <DotNet/System/Array1.h>
-#include <DotNet/System/Collections/Generic/List1.h>
 #include <DotNet/System/Object.h>
 #include <DotNet/Unity/Collections/Allocator.h>
 #include <DotNet/Unity/Collections/LowLevel/Unsafe/NativeArrayUnsafeUtility.h>
 #include <DotNet/Unity/Collections/NativeArray1.h>
 #include <DotNet/Unity/Collections/NativeArrayOptions.h>
 #include <DotNet/UnityEngine/Application.h>
+#include <DotNet/UnityEngine/Bounds.h>
 #include <DotNet/UnityEngine/Debug.h>
 #include <DotNet/UnityEngine/FilterMode.h>
 #include <DotNet/UnityEngine/HideFlags.h>
 #include <DotNet/UnityEngine/Material.h>
+#include <DotNet/UnityEngine/MaterialPropertyBlock.h>
 #include <DotNet/UnityEngine/Matrix4x4.h>
 #include <DotNet/UnityEngine/Mesh.h>
 #include <DotNet/UnityEngine/MeshCollider.h>
@@ -43,8 +50,10 @@
 #include <DotNet/UnityEngine/Object.h>
 #include <DotNet/UnityEngine/Physics.h>
 #include <DotNet/UnityEngine/Quaternion.h>
+#include <DotNet/UnityEngine/Rendering/GraphicsSettings.h>
 #include <DotNet/UnityEngine/Rendering/IndexFormat.h>
 #include <DotNet/UnityEngine/Rendering/MeshUpdateFlags.h>
+#include <DotNet/UnityEngine/Rendering/RenderPipelineAsset.h>
 #include <DotNet/UnityEngine/Rendering/SubMeshDescriptor.h>
 #include <DotNet/UnityEngine/Rendering/VertexAttributeDescriptor.h>
 #include <DotNet/UnityEngine/Resources.h>
@@ -55,10 +64,17 @@
 #include <DotNet/UnityEngine/Vector3.h>
 #include <DotNet/UnityEngine/Vector4.h>
 #include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
 #include <glm/gtc/quaternion.hpp>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <limits>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 
 using namespace Cesium3DTilesSelection;
@@ -71,33 +87,104 @@ using namespace DotNet;
 
 namespace {
 
-template <typename TDest, typename TSource>
-void setIndices(
-    const Unity::Collections::NativeArray1<TDest>& dest,
-    const AccessorView<TSource>& source) {
-  assert(dest.Length() == source.size());
+// Max attribute count supported by Unity, see VertexAttribute.
+constexpr int MAX_ATTRIBUTES = 14;
 
-  TDest* indices = static_cast<TDest*>(
-      Unity::Collections::LowLevel::Unsafe::NativeArrayUnsafeUtility::
-          GetUnsafeBufferPointerWithoutChecks(dest));
+// Max number of texture coordinates supported by Unity, see VertexAttribute.
+constexpr int MAX_TEX_COORDS = 8;
 
+/**
+ * @brief Copies indices from a glTF accessor. Indices that refer to a vertex
+ * that does not exist are replaced with 0, so that Unity doesn't need to
+ * validate the indices again.
+ */
+template <typename TDest, typename TSource>
+void copyIndices(
+    TDest* pDest,
+    const AccessorView<TSource>& source,
+    int64_t vertexCount) {
   for (int64_t i = 0; i < source.size(); ++i) {
-    indices[i] = source[i];
+    const TSource index = source[i];
+    pDest[i] = static_cast<int64_t>(index) < vertexCount
+                   ? static_cast<TDest>(index)
+                   : TDest(0);
   }
 }
 
-template <typename T>
-void generateIndices(
-    const Unity::Collections::NativeArray1<T>& dest,
-    const int32_t count) {
-  assert(dest.Length() == count);
+template <typename T> void generateIndices(T* pDest, const int64_t count) {
+  for (int64_t i = 0; i < count; ++i) {
+    pDest[i] = static_cast<T>(i);
+  }
+}
 
-  T* indices = static_cast<T*>(
-      Unity::Collections::LowLevel::Unsafe::NativeArrayUnsafeUtility::
-          GetUnsafeBufferPointerWithoutChecks(dest));
+/**
+ * @brief Determines how many indices a primitive will have in its Unity
+ * sub-mesh, and whether they need to be stored with 32 bits.
+ */
+int64_t countIndices(
+    const Model& gltf,
+    const MeshPrimitive& primitive,
+    int64_t vertexCount,
+    bool& requires32BitIndices) {
+  if (primitive.indices < 0) {
+    // Indices will be generated for primitives without them.
+    requires32BitIndices = vertexCount > std::numeric_limits<uint16_t>::max();
+    return vertexCount;
+  }
 
-  for (int64_t i = 0; i < count; ++i) {
-    indices[i] = static_cast<T>(i);
+  requires32BitIndices = false;
+
+  AccessorView<uint8_t> indices8(gltf, primitive.indices);
+  if (indices8.status() == AccessorViewStatus::Valid) {
+    return indices8.size();
+  }
+
+  AccessorView<uint16_t> indices16(gltf, primitive.indices);
+  if (indices16.status() == AccessorViewStatus::Valid) {
+    return indices16.size();
+  }
+
+  AccessorView<uint32_t> indices32(gltf, primitive.indices);
+  if (indices32.status() == AccessorViewStatus::Valid) {
+    requires32BitIndices = true;
+    return indices32.size();
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Writes the indices of a primitive, relative to its first vertex.
+ * `pDest` must have room for the number of indices reported by
+ * {@link countIndices}.
+ */
+template <typename TDest>
+void writeIndices(
+    TDest* pDest,
+    const Model& gltf,
+    const MeshPrimitive& primitive,
+    int64_t vertexCount) {
+  if (primitive.indices < 0) {
+    // Generate indices for primitives without them.
+    generateIndices(pDest, vertexCount);
+    return;
+  }
+
+  AccessorView<uint8_t> indices8(gltf, primitive.indices);
+  if (indices8.status() == AccessorViewStatus::Valid) {
+    copyIndices(pDest, indices8, vertexCount);
+    return;
+  }
+
+  AccessorView<uint16_t> indices16(gltf, primitive.indices);
+  if (indices16.status() == AccessorViewStatus::Valid) {
+    copyIndices(pDest, indices16, vertexCount);
+    return;
+  }
+
+  AccessorView<uint32_t> indices32(gltf, primitive.indices);
+  if (indices32.status() == AccessorViewStatus::Valid) {
+    copyIndices(pDest, indices32, vertexCount);
   }
 }
 
@@ -114,11 +201,46 @@ int32_t countPrimitives(const CesiumGltf::Model& model) {
   return numberOfPrimitives;
 }
 
+/**
+ * @brief A group of glTF primitives that are written into a single Unity mesh,
+ * with one sub-mesh per primitive.
+ */
+struct MeshBatch {
+  /**
+   * @brief The indices of the primitives in this batch, in the order in which
+   * they are visited by `Model::forEachPrimitiveInScene`.
+   */
+  std::vector<int32_t> primitives;
+
+  /**
+   * @brief Whether the primitives in this batch are points, which cannot be
+   * baked into a physics mesh.
+   */
+  bool containsPoints = false;
+
+  /**
+   * @brief Maps the vertex positions stored in the Unity mesh to the
+   * coordinate system of the glTF node. This is the identity matrix unless the
+   * positions are quantized.
+   */
+  glm::dmat4 positionTransform{1.0};
+
+  /**
+   * @brief The bounding box of the vertex positions stored in the Unity mesh.
+   */
+  glm::dvec3 boundsMinimum{0.0};
+  glm::dvec3 boundsMaximum{0.0};
+};
+
 /**
  * @brief The result after populating Unity mesh data with loaded glTF content.
  */
 struct MeshDataResult {
-  UnityEngine::MeshDataArray meshDataArray;
+  /**
+   * @brief One single-mesh MeshDataArray per mesh batch.
+   */
+  std::vector<UnityEngine::MeshDataArray> meshDataArrays;
+  std::vector<MeshBatch> batches;
   std::vector<CesiumPrimitiveInfo> primitiveInfos;
 };
 
@@ -226,326 +348,1047 @@ bool validateVertexColors(
   return true;
 }
 
-void populateMeshDataArray(
-    MeshDataResult& meshDataResult,
-    const TileLoadResult& tileLoadResult) {
-  const CesiumGltf::Model* pModel =
-      std::get_if<CesiumGltf::Model>(&tileLoadResult.contentKind);
-  if (!pModel)
-    return;
+/**
+ * @brief The glTF accessors that a primitive's Unity vertices are built from.
+ */
+struct PrimitiveVertexSources {
+  AccessorView<UnityEngine::Vector3> positionView{};
+  AccessorView<UnityEngine::Vector3> normalView{};
+  bool hasNormals = false;
+  int32_t colorAccessorID = -1;
+  bool hasVertexColors = false;
+  int32_t numTexCoords = 0;
+  AccessorView<UnityEngine::Vector2> texCoordViews[MAX_TEX_COORDS];
+
+  /**
+   * @brief Whether a primitive with the given sources produces vertices with
+   * exactly the same Unity vertex attributes as this one, so that both can
+   * share a vertex buffer.
+   */
+  bool hasSameLayout(const PrimitiveVertexSources& other) const {
+    return this->hasNormals == other.hasNormals &&
+           this->hasVertexColors == other.hasVertexColors &&
+           this->numTexCoords == other.numTexCoords;
+  }
+};
+
+/**
+ * @brief The byte offsets of the attributes within one interleaved Unity
+ * vertex.
+ */
+struct VertexLayout {
+  size_t normalOffset;
+  size_t colorOffset;
+  size_t texCoordOffset;
+  size_t texCoordSize;
+  size_t stride;
+};
+
+/**
+ * @brief Determines the layout of an interleaved Unity vertex for primitives
+ * with the given sources, when written with the given vertex format.
+ *
+ * The vertex layout will be as follows:
+ * 1. position
+ * 2. normals (skip if N/A)
+ * 3. vertex colors (skip if N/A)
+ * 4. texcoords (first all TEXCOORD_i, then all _CESIUMOVERLAY_i)
+ */
+VertexLayout computeVertexLayout(
+    const PrimitiveVertexSources& sources,
+    const CesiumVertexFormat& format) {
+  using namespace DotNet::CesiumForUnity;
+
+  VertexLayout layout{};
+
+  // Unity requires every attribute to be a multiple of 4 bytes, so quantized
+  // positions have a fourth component.
+  layout.normalOffset = format.quantizePositions ? 4 * sizeof(uint16_t)
+                                                 : sizeof(UnityEngine::Vector3);
+
+  layout.colorOffset = layout.normalOffset;
+  if (sources.hasNormals) {
+    switch (format.normalFormat) {
+    case CesiumNormalFormat::SNorm8:
+      layout.colorOffset += 4 * sizeof(int8_t);
+      break;
+    case CesiumNormalFormat::SNorm16:
+      layout.colorOffset += 4 * sizeof(int16_t);
+      break;
+    default:
+      layout.colorOffset += sizeof(UnityEngine::Vector3);
+      break;
+    }
+  }
 
-  size_t meshDataInstance = 0;
+  layout.texCoordOffset = layout.colorOffset;
+  if (sources.hasVertexColors) {
+    layout.texCoordOffset += sizeof(uint32_t);
+  }
 
-  meshDataResult.primitiveInfos.reserve(countPrimitives(*pModel));
+  layout.texCoordSize = format.texCoordFormat == CesiumTexCoordFormat::Float16
+                            ? 2 * sizeof(uint16_t)
+                            : sizeof(UnityEngine::Vector2);
 
-  pModel->forEachPrimitiveInScene(
+  layout.stride =
+      layout.texCoordOffset + sources.numTexCoords * layout.texCoordSize;
+  return layout;
+}
+
+/**
+ * @brief Whether all attributes are written as 32-bit floats, exactly as they
+ * are stored in the glTF.
+ */
+bool isUncompressed(const CesiumVertexFormat& format) {
+  using namespace DotNet::CesiumForUnity;
+  return !format.quantizePositions &&
+         format.normalFormat == CesiumNormalFormat::Float32 &&
+         format.texCoordFormat == CesiumTexCoordFormat::Float32;
+}
+
+/**
+ * @brief Finds the accessors for the vertex attributes of a primitive and
+ * records the Unity texture coordinate index used for each glTF texture
+ * coordinate set in the primitive info.
+ *
+ * @returns false if the primitive does not have valid positions and therefore
+ * cannot be rendered.
+ */
+bool gatherVertexSources(
+    const Model& gltf,
+    const MeshPrimitive& primitive,
+    PrimitiveVertexSources& sources,
+    CesiumPrimitiveInfo& primitiveInfo) {
+  auto positionAccessorIt = primitive.attributes.find("POSITION");
+  if (positionAccessorIt == primitive.attributes.end()) {
+    // This primitive doesn't have a POSITION semantic, ignore it.
+    return false;
+  }
+
+  sources.positionView =
+      AccessorView<UnityEngine::Vector3>(gltf, positionAccessorIt->second);
+  if (sources.positionView.status() != AccessorViewStatus::Valid) {
+    // TODO: report invalid accessor
+    return false;
+  }
+
+  const int64_t vertexCount = sources.positionView.size();
+
+  // Add the NORMAL attribute, if it exists.
+  auto normalAccessorIt = primitive.attributes.find("NORMAL");
+  if (normalAccessorIt != primitive.attributes.end()) {
+    sources.normalView =
+        AccessorView<UnityEngine::Vector3>(gltf, normalAccessorIt->second);
+    sources.hasNormals =
+        sources.normalView.status() == AccessorViewStatus::Valid &&
+        sources.normalView.size() >= vertexCount;
+  }
+
+  // Add the COLOR_0 attribute, if it exists.
+  auto colorAccessorIt = primitive.attributes.find("COLOR_0");
+  if (colorAccessorIt != primitive.attributes.end() &&
+      validateVertexColors(gltf, colorAccessorIt->second, vertexCount)) {
+    sources.colorAccessorID = colorAccessorIt->second;
+    sources.hasVertexColors = true;
+  }
+
+  // Add all texture coordinate sets TEXCOORD_i
+  for (int i = 0; i < 8 && sources.numTexCoords < MAX_TEX_COORDS; ++i) {
+    // TODO: Only add texture coordinates that are needed.
+    // E.g., might not need UV coords for metadata.
+
+    // Build accessor view for glTF attribute.
+    auto texCoordAccessorIt =
+        primitive.attributes.find("TEXCOORD_" + std::to_string(i));
+    if (texCoordAccessorIt == primitive.attributes.end()) {
+      continue;
+    }
+
+    AccessorView<UnityEngine::Vector2> texCoordView(
+        gltf,
+        texCoordAccessorIt->second);
+    if (texCoordView.status() != AccessorViewStatus::Valid ||
+        texCoordView.size() < vertexCount) {
+      // TODO: report invalid accessor?
+      continue;
+    }
+
+    sources.texCoordViews[sources.numTexCoords] = texCoordView;
+    primitiveInfo.uvIndexMap[i] = sources.numTexCoords;
+    ++sources.numTexCoords;
+  }
+
+  // Add all texture coordinate sets _CESIUMOVERLAY_i
+  for (int i = 0; i < 8 && sources.numTexCoords < MAX_TEX_COORDS; ++i) {
+    // Build accessor view for glTF attribute.
+    auto overlayAccessorIt =
+        primitive.attributes.find("_CESIUMOVERLAY_" + std::to_string(i));
+    if (overlayAccessorIt == primitive.attributes.end()) {
+      continue;
+    }
+
+    AccessorView<UnityEngine::Vector2> overlayTexCoordView(
+        gltf,
+        overlayAccessorIt->second);
+    if (overlayTexCoordView.status() != AccessorViewStatus::Valid ||
+        overlayTexCoordView.size() < vertexCount) {
+      // TODO: report invalid accessor?
+      continue;
+    }
+
+    sources.texCoordViews[sources.numTexCoords] = overlayTexCoordView;
+    primitiveInfo.rasterOverlayUvIndexMap[i] = sources.numTexCoords;
+    ++sources.numTexCoords;
+  }
+
+  primitiveInfo.containsPoints =
+      primitive.mode == MeshPrimitive::Mode::POINTS;
+
+  return true;
+}
+
+/**
+ * @brief Decides which primitives will be written into which Unity mesh.
+ *
+ * Without `combinePrimitives`, every renderable primitive gets a mesh of its
+ * own. Otherwise, primitives that share a node transform, a vertex layout and a
+ * point / triangle topology are packed into one mesh, each as its own
+ * sub-mesh. Primitives with feature metadata are never combined, because
+ * metadata is looked up per primitive GameObject.
+ */
+std::vector<MeshBatch>
+planMeshBatches(const Model& model, bool combinePrimitives) {
+  if (model.getExtension<ExtensionModelExtFeatureMetadata>()) {
+    combinePrimitives = false;
+  }
+
+  struct BatchKey {
+    glm::dmat4 transform;
+    PrimitiveVertexSources sources;
+  };
+
+  std::vector<MeshBatch> batches;
+  std::vector<BatchKey> keys;
+  int32_t primitiveIndex = 0;
+
+  model.forEachPrimitiveInScene(
       -1,
-      [&meshDataResult, &meshDataInstance](
+      [combinePrimitives, &batches, &keys, &primitiveIndex](
           const Model& gltf,
           const Node& node,
           const Mesh& mesh,
           const MeshPrimitive& primitive,
           const glm::dmat4& transform) {
-        UnityEngine::MeshData meshData =
-            meshDataResult.meshDataArray[meshDataInstance++];
-        CesiumPrimitiveInfo& primitiveInfo =
-            meshDataResult.primitiveInfos.emplace_back();
-
-        using namespace DotNet::UnityEngine;
-        using namespace DotNet::UnityEngine::Rendering;
-        using namespace DotNet::Unity::Collections;
-        using namespace DotNet::Unity::Collections::LowLevel::Unsafe;
-
-        // Max attribute count supported by Unity, see VertexAttribute.
-        const int MAX_ATTRIBUTES = 14;
-        VertexAttributeDescriptor descriptor[MAX_ATTRIBUTES];
-
-        // Interleave all attributes into single stream.
-        std::int32_t numberOfAttributes = 0;
-        std::int32_t streamIndex = 0;
-
-        auto positionAccessorIt = primitive.attributes.find("POSITION");
-        if (positionAccessorIt == primitive.attributes.end()) {
-          // This primitive doesn't have a POSITION semantic, ignore it.
-          return;
-        }
+        const int32_t index = primitiveIndex++;
 
-        int32_t positionAccessorID = positionAccessorIt->second;
-        AccessorView<UnityEngine::Vector3> positionView(
-            gltf,
-            positionAccessorID);
-        if (positionView.status() != AccessorViewStatus::Valid) {
-          // TODO: report invalid accessor
+        PrimitiveVertexSources sources;
+        CesiumPrimitiveInfo primitiveInfo;
+        if (!gatherVertexSources(gltf, primitive, sources, primitiveInfo)) {
           return;
         }
 
-        assert(numberOfAttributes < MAX_ATTRIBUTES);
-        descriptor[numberOfAttributes].attribute = VertexAttribute::Position;
-        descriptor[numberOfAttributes].format = VertexAttributeFormat::Float32;
-        descriptor[numberOfAttributes].dimension = 3;
-        descriptor[numberOfAttributes].stream = streamIndex;
-        ++numberOfAttributes;
-
-        // Add the NORMAL attribute, if it exists.
-        auto normalAccessorIt = primitive.attributes.find("NORMAL");
-        AccessorView<UnityEngine::Vector3> normalView =
-            normalAccessorIt != primitive.attributes.end()
-                ? AccessorView<UnityEngine::Vector3>(
-                      gltf,
-                      normalAccessorIt->second)
-                : AccessorView<UnityEngine::Vector3>();
-
-        if (normalView.status() == AccessorViewStatus::Valid &&
-            normalView.size() >= positionView.size()) {
-          assert(numberOfAttributes < MAX_ATTRIBUTES);
-          descriptor[numberOfAttributes].attribute = VertexAttribute::Normal;
-          descriptor[numberOfAttributes].format =
-              VertexAttributeFormat::Float32;
-          descriptor[numberOfAttributes].dimension = 3;
-          descriptor[numberOfAttributes].stream = streamIndex;
-          ++numberOfAttributes;
+        if (combinePrimitives) {
+          for (size_t i = 0; i < batches.size(); ++i) {
+            if (batches[i].containsPoints == primitiveInfo.containsPoints &&
+                keys[i].transform == transform &&
+                keys[i].sources.hasSameLayout(sources)) {
+              batches[i].primitives.push_back(index);
+              return;
+            }
+          }
         }
 
-        // Add the COLOR_0 attribute, if it exists.
-        auto colorAccessorIt = primitive.attributes.find("COLOR_0");
-        bool hasVertexColors = colorAccessorIt != primitive.attributes.end() &&
-                               validateVertexColors(
-                                   gltf,
-                                   colorAccessorIt->second,
-                                   positionView.size());
-        if (hasVertexColors) {
-          assert(numberOfAttributes < MAX_ATTRIBUTES);
-
-          // Unity expects the vertex colors to come as 4 normalized uint8s.
-          descriptor[numberOfAttributes].attribute = VertexAttribute::Color;
-          descriptor[numberOfAttributes].format = VertexAttributeFormat::UNorm8;
-          descriptor[numberOfAttributes].dimension = 4;
-          descriptor[numberOfAttributes].stream = streamIndex;
-          ++numberOfAttributes;
-        }
+        MeshBatch& batch = batches.emplace_back();
+        batch.primitives.push_back(index);
+        batch.containsPoints = primitiveInfo.containsPoints;
+        keys.push_back(BatchKey{transform, sources});
+      });
 
-        // Max number of texture coordinates supported by Unity, see
-        // VertexAttribute.
-        constexpr int MAX_TEX_COORDS = 8;
-        int numTexCoords = 0;
-        AccessorView<UnityEngine::Vector2> texCoordViews[MAX_TEX_COORDS];
-
-        // Add all texture coordinate sets TEXCOORD_i
-        for (int i = 0; i < 8 && numTexCoords < MAX_TEX_COORDS; ++i) {
-          // TODO: Only add texture coordinates that are needed.
-          // E.g., might not need UV coords for metadata.
-
-          // Build accessor view for glTF attribute.
-          auto texCoordAccessorIt =
-              primitive.attributes.find("TEXCOORD_" + std::to_string(i));
-          if (texCoordAccessorIt == primitive.attributes.end()) {
-            continue;
-          }
+  return batches;
+}
 
-          AccessorView<UnityEngine::Vector2> texCoordView(
-              gltf,
-              texCoordAccessorIt->second);
-          if (texCoordView.status() != AccessorViewStatus::Valid &&
-              texCoordView.size() >= positionView.size()) {
-            // TODO: report invalid accessor?
-            continue;
-          }
+/**
+ * @brief Describes the interleaved Unity vertex attributes for primitives with
+ * the given sources.
+ *
+ * @returns The number of attributes written to `descriptor`.
+ */
+int32_t describeVertexAttributes(
+    const PrimitiveVertexSources& sources,
+    const CesiumVertexFormat& format,
+    UnityEngine::Rendering::VertexAttributeDescriptor
+        descriptor[MAX_ATTRIBUTES]) {
+  using namespace DotNet::CesiumForUnity;
+  using namespace DotNet::UnityEngine::Rendering;
+
+  // Interleave all attributes into single stream.
+  std::int32_t numberOfAttributes = 0;
+  const std::int32_t streamIndex = 0;
+
+  assert(numberOfAttributes < MAX_ATTRIBUTES);
+  descriptor[numberOfAttributes].attribute = VertexAttribute::Position;
+  if (format.quantizePositions) {
+    descriptor[numberOfAttributes].format = VertexAttributeFormat::UNorm16;
+    descriptor[numberOfAttributes].dimension = 4;
+  } else {
+    descriptor[numberOfAttributes].format = VertexAttributeFormat::Float32;
+    descriptor[numberOfAttributes].dimension = 3;
+  }
+  descriptor[numberOfAttributes].stream = streamIndex;
+  ++numberOfAttributes;
+
+  if (sources.hasNormals) {
+    assert(numberOfAttributes < MAX_ATTRIBUTES);
+    descriptor[numberOfAttributes].attribute = VertexAttribute::Normal;
+    switch (format.normalFormat) {
+    case CesiumNormalFormat::SNorm8:
+      descriptor[numberOfAttributes].format = VertexAttributeFormat::SNorm8;
+      descriptor[numberOfAttributes].dimension = 4;
+      break;
+    case CesiumNormalFormat::SNorm16:
+      descriptor[numberOfAttributes].format = VertexAttributeFormat::SNorm16;
+      descriptor[numberOfAttributes].dimension = 4;
+      break;
+    default:
+      descriptor[numberOfAttributes].format = VertexAttributeFormat::Float32;
+      descriptor[numberOfAttributes].dimension = 3;
+      break;
+    }
+    descriptor[numberOfAttributes].stream = streamIndex;
+    ++numberOfAttributes;
+  }
 
-          texCoordViews[numTexCoords] = texCoordView;
-          primitiveInfo.uvIndexMap[i] = numTexCoords;
+  if (sources.hasVertexColors) {
+    assert(numberOfAttributes < MAX_ATTRIBUTES);
 
-          // Build Unity descriptor for this attribute.
-          assert(numberOfAttributes < MAX_ATTRIBUTES);
+    // Unity expects the vertex colors to come as 4 normalized uint8s.
+    descriptor[numberOfAttributes].attribute = VertexAttribute::Color;
+    descriptor[numberOfAttributes].format = VertexAttributeFormat::UNorm8;
+    descriptor[numberOfAttributes].dimension = 4;
+    descriptor[numberOfAttributes].stream = streamIndex;
+    ++numberOfAttributes;
+  }
 
-          descriptor[numberOfAttributes].attribute =
-              (VertexAttribute)((int)VertexAttribute::TexCoord0 + numTexCoords);
-          descriptor[numberOfAttributes].format =
-              VertexAttributeFormat::Float32;
-          descriptor[numberOfAttributes].dimension = 2;
-          descriptor[numberOfAttributes].stream = streamIndex;
+  for (int32_t i = 0; i < sources.numTexCoords; ++i) {
+    assert(numberOfAttributes < MAX_ATTRIBUTES);
+    descriptor[numberOfAttributes].attribute =
+        (VertexAttribute)((int)VertexAttribute::TexCoord0 + i);
+    descriptor[numberOfAttributes].format =
+        format.texCoordFormat == CesiumTexCoordFormat::Float16
+            ? VertexAttributeFormat::Float16
+            : VertexAttributeFormat::Float32;
+    descriptor[numberOfAttributes].dimension = 2;
+    descriptor[numberOfAttributes].stream = streamIndex;
+    ++numberOfAttributes;
+  }
 
-          ++numTexCoords;
-          ++numberOfAttributes;
-        }
+  return numberOfAttributes;
+}
 
-        // Add all texture coordinate sets _CESIUMOVERLAY_i
-        for (int i = 0; i < 8 && numTexCoords < MAX_TEX_COORDS; ++i) {
-          // Build accessor view for glTF attribute.
-          auto overlayAccessorIt =
-              primitive.attributes.find("_CESIUMOVERLAY_" + std::to_string(i));
-          if (overlayAccessorIt == primitive.attributes.end()) {
-            continue;
-          }
+/**
+ * @brief Returns a pointer to the first element of an accessor whose elements
+ * are tightly packed, or nullptr if the accessor is strided.
+ */
+template <typename T> const T* getContiguousData(const AccessorView<T>& view) {
+  if (view.status() != AccessorViewStatus::Valid ||
+      view.stride() != static_cast<int64_t>(sizeof(T))) {
+    return nullptr;
+  }
+  return reinterpret_cast<const T*>(view.data() + view.offset());
+}
 
-          AccessorView<UnityEngine::Vector2> overlayTexCoordView(
-              gltf,
-              overlayAccessorIt->second);
-          if (overlayTexCoordView.status() != AccessorViewStatus::Valid &&
-              overlayTexCoordView.size() >= positionView.size()) {
-            // TODO: report invalid accessor?
-            continue;
-          }
+/**
+ * @brief Interleaves the vertices of a primitive with a fixed vertex layout.
+ *
+ * The layout is known at compile time, so every per-vertex copy has a
+ * constant size and offset and there are no per-vertex branches. When all
+ * source accessors are tightly packed, they are read directly through raw
+ * pointers. Otherwise this falls back to reading each element through its
+ * AccessorView.
+ *
+ * Since the vertex buffer is dynamically interleaved, we don't have a
+ * convenient struct to represent the vertex data.
+ * The vertex layout will be as follows:
+ * 1. position
+ * 2. normals (skip if N/A)
+ * 3. vertex colors (skip if N/A, filled in separately)
+ * 4. texcoords (first all TEXCOORD_i, then all _CESIUMOVERLAY_i)
+ */
+template <bool HasNormals, bool HasVertexColors, size_t NumTexCoords>
+void interleaveVertices(
+    const PrimitiveVertexSources& sources,
+    uint8_t* pBufferStart) {
+  using namespace DotNet::UnityEngine;
+
+  constexpr size_t normalOffset = sizeof(Vector3);
+  constexpr size_t texCoordOffset = normalOffset +
+                                    (HasNormals ? sizeof(Vector3) : 0) +
+                                    (HasVertexColors ? sizeof(uint32_t) : 0);
+  constexpr size_t stride = texCoordOffset + NumTexCoords * sizeof(Vector2);
+
+  const int64_t vertexCount = sources.positionView.size();
+
+  const Vector3* pPositions = getContiguousData(sources.positionView);
+  const Vector3* pNormals =
+      HasNormals ? getContiguousData(sources.normalView) : nullptr;
+  const Vector2* texCoords[NumTexCoords > 0 ? NumTexCoords : 1]{};
+
+  bool isContiguous = pPositions != nullptr && (!HasNormals || pNormals);
+  for (size_t t = 0; t < NumTexCoords; ++t) {
+    texCoords[t] = getContiguousData(sources.texCoordViews[t]);
+    isContiguous = isContiguous && texCoords[t] != nullptr;
+  }
+
+  if (isContiguous) {
+    uint8_t* pWritePos = pBufferStart;
+    for (int64_t i = 0; i < vertexCount; ++i, pWritePos += stride) {
+      std::memcpy(pWritePos, pPositions + i, sizeof(Vector3));
+      if constexpr (HasNormals) {
+        std::memcpy(pWritePos + normalOffset, pNormals + i, sizeof(Vector3));
+      }
+      for (size_t t = 0; t < NumTexCoords; ++t) {
+        std::memcpy(
+            pWritePos + texCoordOffset + t * sizeof(Vector2),
+            texCoords[t] + i,
+            sizeof(Vector2));
+      }
+    }
+  } else {
+    uint8_t* pWritePos = pBufferStart;
+    for (int64_t i = 0; i < vertexCount; ++i, pWritePos += stride) {
+      *reinterpret_cast<Vector3*>(pWritePos) = sources.positionView[i];
+      if constexpr (HasNormals) {
+        *reinterpret_cast<Vector3*>(pWritePos + normalOffset) =
+            sources.normalView[i];
+      }
+      for (size_t t = 0; t < NumTexCoords; ++t) {
+        *reinterpret_cast<Vector2*>(
+            pWritePos + texCoordOffset + t * sizeof(Vector2)) =
+            sources.texCoordViews[t][i];
+      }
+    }
+  }
+}
 
-          texCoordViews[numTexCoords] = overlayTexCoordView;
-          primitiveInfo.rasterOverlayUvIndexMap[i] = numTexCoords;
+using InterleaveKernel = void (*)(const PrimitiveVertexSources&, uint8_t*);
 
-          // Build Unity descriptor for this attribute.
-          assert(numberOfAttributes < MAX_ATTRIBUTES);
+template <bool HasNormals, bool HasVertexColors, size_t... NumTexCoords>
+constexpr std::array<InterleaveKernel, sizeof...(NumTexCoords)>
+makeInterleaveKernels(std::index_sequence<NumTexCoords...>) {
+  return {&interleaveVertices<HasNormals, HasVertexColors, NumTexCoords>...};
+}
 
-          descriptor[numberOfAttributes].attribute =
-              (VertexAttribute)((int)VertexAttribute::TexCoord0 + numTexCoords);
-          descriptor[numberOfAttributes].format =
-              VertexAttributeFormat::Float32;
-          descriptor[numberOfAttributes].dimension = 2;
-          descriptor[numberOfAttributes].stream = streamIndex;
+/**
+ * @brief Selects the interleaving kernel that was compiled for the vertex
+ * layout of the given primitive.
+ */
+InterleaveKernel selectInterleaveKernel(const PrimitiveVertexSources& sources) {
+  using TexCoordCounts = std::make_index_sequence<MAX_TEX_COORDS + 1>;
+
+  static constexpr std::array<InterleaveKernel, MAX_TEX_COORDS + 1>
+      kernels[2][2] = {
+          {makeInterleaveKernels<false, false>(TexCoordCounts{}),
+           makeInterleaveKernels<false, true>(TexCoordCounts{})},
+          {makeInterleaveKernels<true, false>(TexCoordCounts{}),
+           makeInterleaveKernels<true, true>(TexCoordCounts{})}};
+
+  return kernels[sources.hasNormals][sources.hasVertexColors]
+                [sources.numTexCoords];
+}
 
-          ++numTexCoords;
-          ++numberOfAttributes;
-        }
+/**
+ * @brief Encodes the vertices of a primitive into a compressed vertex format.
+ *
+ * Each attribute is written in its own pass over the vertices, so that the
+ * format of the attribute is only checked once.
+ *
+ * @param positionOrigin The position that maps to zero when quantizing.
+ * @param positionScale The factor that maps positions relative to the origin
+ * into the 0-1 range when quantizing.
+ */
+void encodeVertices(
+    const PrimitiveVertexSources& sources,
+    const CesiumVertexFormat& format,
+    const VertexLayout& layout,
+    const glm::dvec3& positionOrigin,
+    double positionScale,
+    uint8_t* pBufferStart) {
+  using namespace DotNet::CesiumForUnity;
+  using namespace DotNet::UnityEngine;
+
+  const int64_t vertexCount = sources.positionView.size();
+
+  uint8_t* pWritePos = pBufferStart;
+  if (format.quantizePositions) {
+    for (int64_t i = 0; i < vertexCount; ++i, pWritePos += layout.stride) {
+      const Vector3& position = sources.positionView[i];
+      const glm::dvec3 normalized =
+          (glm::dvec3(position.x, position.y, position.z) - positionOrigin) *
+          positionScale;
+      const uint64_t packed =
+          glm::packUnorm4x16(glm::vec4(glm::vec3(normalized), 1.0f));
+      std::memcpy(pWritePos, &packed, sizeof(packed));
+    }
+  } else {
+    for (int64_t i = 0; i < vertexCount; ++i, pWritePos += layout.stride) {
+      *reinterpret_cast<Vector3*>(pWritePos) = sources.positionView[i];
+    }
+  }
 
-        System::Array1<VertexAttributeDescriptor> attributes(
-            numberOfAttributes);
-        for (int32_t i = 0; i < numberOfAttributes; ++i) {
-          attributes.Item(i, descriptor[i]);
-        }
+  if (sources.hasNormals) {
+    pWritePos = pBufferStart + layout.normalOffset;
+    switch (format.normalFormat) {
+    case CesiumNormalFormat::SNorm8:
+      for (int64_t i = 0; i < vertexCount; ++i, pWritePos += layout.stride) {
+        const Vector3& normal = sources.normalView[i];
+        const uint32_t packed = glm::packSnorm4x8(
+            glm::vec4(normal.x, normal.y, normal.z, 0.0f));
+        std::memcpy(pWritePos, &packed, sizeof(packed));
+      }
+      break;
+    case CesiumNormalFormat::SNorm16:
+      for (int64_t i = 0; i < vertexCount; ++i, pWritePos += layout.stride) {
+        const Vector3& normal = sources.normalView[i];
+        const uint64_t packed = glm::packSnorm4x16(
+            glm::vec4(normal.x, normal.y, normal.z, 0.0f));
+        std::memcpy(pWritePos, &packed, sizeof(packed));
+      }
+      break;
+    default:
+      for (int64_t i = 0; i < vertexCount; ++i, pWritePos += layout.stride) {
+        *reinterpret_cast<Vector3*>(pWritePos) = sources.normalView[i];
+      }
+      break;
+    }
+  }
 
-        meshData.SetVertexBufferParams(positionView.size(), attributes);
-
-        NativeArray1<uint8_t> nativeVertexBuffer =
-            meshData.GetVertexData<uint8_t>(streamIndex);
-        uint8_t* pBufferStart = static_cast<uint8_t*>(
-            NativeArrayUnsafeUtility::GetUnsafeBufferPointerWithoutChecks(
-                nativeVertexBuffer));
-        uint8_t* pWritePos = pBufferStart;
-
-        // Since the vertex buffer is dynamically interleaved, we don't have a
-        // convenient struct to represent the vertex data.
-        // The vertex layout will be as follows:
-        // 1. position
-        // 2. normals (skip if N/A)
-        // 3. vertex colors (skip if N/A)
-        // 4. texcoords (first all TEXCOORD_i, then all _CESIUMOVERLAY_i)
-        for (int64_t i = 0; i < positionView.size(); ++i) {
-          *reinterpret_cast<Vector3*>(pWritePos) = positionView[i];
-          pWritePos += sizeof(Vector3);
-
-          if (normalView.status() == AccessorViewStatus::Valid) {
-            *reinterpret_cast<Vector3*>(pWritePos) = normalView[i];
-            pWritePos += sizeof(Vector3);
-          }
+  for (int32_t t = 0; t < sources.numTexCoords; ++t) {
+    const AccessorView<Vector2>& texCoordView = sources.texCoordViews[t];
+    pWritePos = pBufferStart + layout.texCoordOffset + t * layout.texCoordSize;
+    if (format.texCoordFormat == CesiumTexCoordFormat::Float16) {
+      for (int64_t i = 0; i < vertexCount; ++i, pWritePos += layout.stride) {
+        const Vector2& texCoord = texCoordView[i];
+        const uint32_t packed =
+            glm::packHalf2x16(glm::vec2(texCoord.x, texCoord.y));
+        std::memcpy(pWritePos, &packed, sizeof(packed));
+      }
+    } else {
+      for (int64_t i = 0; i < vertexCount; ++i, pWritePos += layout.stride) {
+        *reinterpret_cast<Vector2*>(pWritePos) = texCoordView[i];
+      }
+    }
+  }
+}
 
-          // Skip the slot allocated for vertex colors, we will fill them in
-          // bulk later.
-          if (hasVertexColors) {
-            pWritePos += sizeof(uint32_t);
-          }
+/**
+ * @brief Writes the vertices of a single primitive into an interleaved vertex
+ * buffer, starting at `pBufferStart`.
+ */
+void writeVertices(
+    const Model& gltf,
+    const PrimitiveVertexSources& sources,
+    const CesiumVertexFormat& format,
+    const VertexLayout& layout,
+    const glm::dvec3& positionOrigin,
+    double positionScale,
+    uint8_t* pBufferStart) {
+  if (isUncompressed(format)) {
+    selectInterleaveKernel(sources)(sources, pBufferStart);
+  } else {
+    encodeVertices(
+        sources,
+        format,
+        layout,
+        positionOrigin,
+        positionScale,
+        pBufferStart);
+  }
 
-          for (uint32_t texCoordIndex = 0; texCoordIndex < numTexCoords;
-               ++texCoordIndex) {
-            *reinterpret_cast<Vector2*>(pWritePos) =
-                texCoordViews[texCoordIndex][i];
-            pWritePos += sizeof(Vector2);
-          }
-        }
+  // Fill in vertex colors separately, if they exist.
+  if (sources.hasVertexColors) {
+    createAccessorView(
+        gltf,
+        sources.colorAccessorID,
+        CopyVertexColors{
+            pBufferStart + layout.colorOffset,
+            layout.stride,
+            static_cast<size_t>(sources.positionView.size())});
+  }
+}
 
-        // Fill in vertex colors separately, if they exist.
-        if (hasVertexColors) {
-          // Color comes after position and normal.
-          size_t colorByteOffset = sizeof(Vector3);
-          if (normalView.status() == AccessorViewStatus::Valid) {
-            colorByteOffset += sizeof(Vector3);
-          }
+/**
+ * @brief Computes the bounding box of a primitive's positions.
+ *
+ * The positions are always scanned rather than trusting the POSITION
+ * accessor's min and max. Those are optional in practice and sometimes wrong,
+ * and quantized positions outside the bounds would wrap or clamp.
+ */
+void computePositionBounds(
+    const PrimitiveVertexSources& sources,
+    glm::dvec3& minimum,
+    glm::dvec3& maximum) {
+  minimum = glm::dvec3(std::numeric_limits<double>::max());
+  maximum = glm::dvec3(std::numeric_limits<double>::lowest());
+  for (int64_t i = 0; i < sources.positionView.size(); ++i) {
+    const UnityEngine::Vector3& position = sources.positionView[i];
+    const glm::dvec3 p(position.x, position.y, position.z);
+    minimum = glm::min(minimum, p);
+    maximum = glm::max(maximum, p);
+  }
 
-          // Stride includes position, normal, ...
-          size_t stride = colorByteOffset;
-          // color, ...
-          stride += sizeof(uint32_t);
-          // and tex coords.
-          stride += numTexCoords * sizeof(Vector2);
-
-          createAccessorView(
-              gltf,
-              colorAccessorIt->second,
-              CopyVertexColors{
-                  pBufferStart + colorByteOffset,
-                  stride,
-                  static_cast<size_t>(positionView.size())});
-        }
+  if (sources.positionView.size() == 0) {
+    minimum = maximum = glm::dvec3(0.0);
+  }
+}
 
-        int32_t indexCount = 0;
+UnityEngine::Bounds
+createBounds(const glm::dvec3& minimum, const glm::dvec3& maximum) {
+  const glm::dvec3 center = (minimum + maximum) * 0.5;
+  const glm::dvec3 size = maximum - minimum;
+  return CesiumForUnity::Helpers::CreateBounds(
+      UnityEngine::Vector3{
+          static_cast<float>(center.x),
+          static_cast<float>(center.y),
+          static_cast<float>(center.z)},
+      UnityEngine::Vector3{
+          static_cast<float>(size.x),
+          static_cast<float>(size.y),
+          static_cast<float>(size.z)});
+}
 
-        if (primitive.indices >= 0) {
-          AccessorView<uint8_t> indices8(gltf, primitive.indices);
-          if (indices8.status() == AccessorViewStatus::Valid) {
-            indexCount = indices8.size();
-            meshData.SetIndexBufferParams(indexCount, IndexFormat::UInt16);
-            setIndices(meshData.GetIndexData<std::uint16_t>(), indices8);
-          }
+/**
+ * @brief Writes the primitives of one batch into a Unity MeshData, with one
+ * sub-mesh per primitive.
+ */
+void populateMeshData(
+    UnityEngine::MeshData& meshData,
+    const Model& gltf,
+    const std::vector<const MeshPrimitive*>& primitives,
+    const CesiumVertexFormat& format,
+    MeshBatch& batch,
+    int32_t meshIndex,
+    std::vector<CesiumPrimitiveInfo>& primitiveInfos) {
+  using namespace DotNet::UnityEngine;
+  using namespace DotNet::UnityEngine::Rendering;
+  using namespace DotNet::Unity::Collections;
+  using namespace DotNet::Unity::Collections::LowLevel::Unsafe;
+
+  const size_t subMeshCount = batch.primitives.size();
+
+  std::vector<PrimitiveVertexSources> sources(subMeshCount);
+  std::vector<int64_t> indexCounts(subMeshCount);
+  std::vector<glm::dvec3> minimums(subMeshCount);
+  std::vector<glm::dvec3> maximums(subMeshCount);
+  int64_t vertexCount = 0;
+  int64_t indexCount = 0;
+  bool requires32BitIndices = false;
+
+  for (size_t i = 0; i < subMeshCount; ++i) {
+    const int32_t primitiveIndex = batch.primitives[i];
+    const MeshPrimitive& primitive = *primitives[primitiveIndex];
+    CesiumPrimitiveInfo& primitiveInfo = primitiveInfos[primitiveIndex];
+
+    // The batch was planned from primitives that have valid positions, so
+    // this can't fail.
+    gatherVertexSources(gltf, primitive, sources[i], primitiveInfo);
+    primitiveInfo.meshIndex = meshIndex;
+    primitiveInfo.subMeshIndex = static_cast<int32_t>(i);
+
+    computePositionBounds(sources[i], minimums[i], maximums[i]);
+    if (i == 0) {
+      batch.boundsMinimum = minimums[i];
+      batch.boundsMaximum = maximums[i];
+    } else {
+      batch.boundsMinimum = glm::min(batch.boundsMinimum, minimums[i]);
+      batch.boundsMaximum = glm::max(batch.boundsMaximum, maximums[i]);
+    }
 
-          AccessorView<uint16_t> indices16(gltf, primitive.indices);
-          if (indices16.status() == AccessorViewStatus::Valid) {
-            indexCount = indices16.size();
-            meshData.SetIndexBufferParams(indexCount, IndexFormat::UInt16);
-            setIndices(meshData.GetIndexData<std::uint16_t>(), indices16);
-          }
+    const int64_t primitiveVertexCount = sources[i].positionView.size();
+    bool primitiveRequires32BitIndices = false;
+    indexCounts[i] = countIndices(
+        gltf,
+        primitive,
+        primitiveVertexCount,
+        primitiveRequires32BitIndices);
+
+    vertexCount += primitiveVertexCount;
+    indexCount += indexCounts[i];
+    requires32BitIndices =
+        requires32BitIndices || primitiveRequires32BitIndices;
+  }
 
-          AccessorView<uint32_t> indices32(gltf, primitive.indices);
-          if (indices32.status() == AccessorViewStatus::Valid) {
-            indexCount = indices32.size();
-            meshData.SetIndexBufferParams(indexCount, IndexFormat::UInt32);
-            setIndices(meshData.GetIndexData<std::uint32_t>(), indices32);
-          }
-        } else {
-          // Generate indices for primitives without them.
-          indexCount = positionView.size();
-
-          if (indexCount > std::numeric_limits<uint16_t>::max()) {
-            meshData.SetIndexBufferParams(indexCount, IndexFormat::UInt32);
-            generateIndices(meshData.GetIndexData<std::uint32_t>(), indexCount);
-          } else {
-            meshData.SetIndexBufferParams(indexCount, IndexFormat::UInt16);
-            generateIndices(meshData.GetIndexData<std::uint16_t>(), indexCount);
-          }
-        }
+  // Combined meshes address their vertices with a per-sub-mesh base vertex,
+  // but keep the index format wide enough for the whole vertex buffer.
+  if (subMeshCount > 1 && vertexCount > std::numeric_limits<uint16_t>::max()) {
+    requires32BitIndices = true;
+  }
+
+  // Quantized positions are stored relative to the corner of the batch's
+  // bounding box, with the same scale on every axis so that normals are not
+  // distorted by the dequantization transform.
+  glm::dvec3 positionOrigin(0.0);
+  double positionScale = 1.0;
+  if (format.quantizePositions && vertexCount > 0) {
+    const glm::dvec3 extent = batch.boundsMaximum - batch.boundsMinimum;
+    const double maxExtent =
+        std::max(std::max(extent.x, extent.y), std::max(extent.z, 1e-9));
+
+    positionOrigin = batch.boundsMinimum;
+    positionScale = 1.0 / maxExtent;
+    batch.positionTransform =
+        glm::translate(glm::dmat4(1.0), batch.boundsMinimum) *
+        glm::scale(glm::dmat4(1.0), glm::dvec3(maxExtent));
+
+    // Bounds are expressed in the quantized coordinate system of the mesh.
+    for (size_t i = 0; i < subMeshCount; ++i) {
+      minimums[i] = (minimums[i] - positionOrigin) * positionScale;
+      maximums[i] = (maximums[i] - positionOrigin) * positionScale;
+    }
+    batch.boundsMaximum =
+        (batch.boundsMaximum - positionOrigin) * positionScale;
+    batch.boundsMinimum = glm::dvec3(0.0);
+  }
+
+  VertexAttributeDescriptor descriptor[MAX_ATTRIBUTES];
+  const int32_t numberOfAttributes =
+      describeVertexAttributes(sources[0], format, descriptor);
+
+  System::Array1<VertexAttributeDescriptor> attributes(numberOfAttributes);
+  for (int32_t i = 0; i < numberOfAttributes; ++i) {
+    attributes.Item(i, descriptor[i]);
+  }
+
+  meshData.SetVertexBufferParams(static_cast<int32_t>(vertexCount), attributes);
+
+  NativeArray1<uint8_t> nativeVertexBuffer = meshData.GetVertexData<uint8_t>(0);
+  uint8_t* pBufferStart = static_cast<uint8_t*>(
+      NativeArrayUnsafeUtility::GetUnsafeBufferPointerWithoutChecks(
+          nativeVertexBuffer));
+
+  const VertexLayout layout = computeVertexLayout(sources[0], format);
+
+  meshData.SetIndexBufferParams(
+      static_cast<int32_t>(indexCount),
+      requires32BitIndices ? IndexFormat::UInt32 : IndexFormat::UInt16);
+
+  void* pIndices = nullptr;
+  if (requires32BitIndices) {
+    pIndices = NativeArrayUnsafeUtility::GetUnsafeBufferPointerWithoutChecks(
+        meshData.GetIndexData<std::uint32_t>());
+  } else {
+    pIndices = NativeArrayUnsafeUtility::GetUnsafeBufferPointerWithoutChecks(
+        meshData.GetIndexData<std::uint16_t>());
+  }
+
+  meshData.subMeshCount(static_cast<int32_t>(subMeshCount));
+
+  int64_t vertexOffset = 0;
+  int64_t indexOffset = 0;
+
+  for (size_t i = 0; i < subMeshCount; ++i) {
+    const MeshPrimitive& primitive = *primitives[batch.primitives[i]];
+    const int64_t primitiveVertexCount = sources[i].positionView.size();
+
+    writeVertices(
+        gltf,
+        sources[i],
+        format,
+        layout,
+        positionOrigin,
+        positionScale,
+        pBufferStart + vertexOffset * layout.stride);
+
+    if (requires32BitIndices) {
+      writeIndices(
+          static_cast<std::uint32_t*>(pIndices) + indexOffset,
+          gltf,
+          primitive,
+          primitiveVertexCount);
+    } else {
+      writeIndices(
+          static_cast<std::uint16_t*>(pIndices) + indexOffset,
+          gltf,
+          primitive,
+          primitiveVertexCount);
+    }
+
+    SubMeshDescriptor subMeshDescriptor{};
+
+    if (primitive.mode == MeshPrimitive::Mode::POINTS) {
+      subMeshDescriptor.topology = MeshTopology::Points;
+    } else {
+      subMeshDescriptor.topology = MeshTopology::Triangles;
+    }
+
+    subMeshDescriptor.indexStart = static_cast<int32_t>(indexOffset);
+    subMeshDescriptor.indexCount = static_cast<int32_t>(indexCounts[i]);
+    subMeshDescriptor.baseVertex = static_cast<int32_t>(vertexOffset);
+
+    // Indices were validated while copying them and the bounds are known, so
+    // Unity doesn't need to scan the vertices and indices again.
+    subMeshDescriptor.firstVertex = static_cast<int32_t>(vertexOffset);
+    subMeshDescriptor.vertexCount = static_cast<int32_t>(primitiveVertexCount);
+    subMeshDescriptor.bounds = createBounds(minimums[i], maximums[i]);
+
+    meshData.SetSubMesh(
+        static_cast<int32_t>(i),
+        subMeshDescriptor,
+        MeshUpdateFlags::DontRecalculateBounds |
+            MeshUpdateFlags::DontValidateIndices);
+
+    vertexOffset += primitiveVertexCount;
+    indexOffset += indexCounts[i];
+  }
+}
 
-        meshData.subMeshCount(1);
+void populateMeshDataArray(
+    MeshDataResult& meshDataResult,
+    const TileLoadResult& tileLoadResult,
+    const CesiumVertexFormat& format) {
+  const CesiumGltf::Model* pModel =
+      std::get_if<CesiumGltf::Model>(&tileLoadResult.contentKind);
+  if (!pModel)
+    return;
+
+  std::vector<const MeshPrimitive*> primitives;
+  primitives.reserve(countPrimitives(*pModel));
+  pModel->forEachPrimitiveInScene(
+      -1,
+      [&primitives](
+          const Model& gltf,
+          const Node& node,
+          const Mesh& mesh,
+          const MeshPrimitive& primitive,
+          const glm::dmat4& transform) { primitives.push_back(&primitive); });
+
+  meshDataResult.primitiveInfos.resize(primitives.size());
+
+  for (size_t i = 0; i < meshDataResult.batches.size(); ++i) {
+    const int32_t meshIndex = static_cast<int32_t>(i);
+    UnityEngine::MeshData meshData = meshDataResult.meshDataArrays[i][0];
+    populateMeshData(
+        meshData,
+        *pModel,
+        primitives,
+        format,
+        meshDataResult.batches[i],
+        meshIndex,
+        meshDataResult.primitiveInfos);
+  }
+}
+
+/**
+ * @brief Finds the images of a glTF that may be compressed to BC1: those that
+ * are only used as base color textures.
+ *
+ * BC1 is too lossy for normal, metallic-roughness, occlusion, and emissive
+ * textures, so images used for any of those, even if they are also used as a
+ * base color texture, are left alone.
+ */
+std::vector<bool> findCompressibleImages(const Model& model) {
+  std::vector<bool> isBaseColor(model.images.size(), false);
+  std::vector<bool> isOther(model.images.size(), false);
+
+  auto markImage = [&model](
+                       std::vector<bool>& images,
+                       const auto& maybeTextureInfo) {
+    if (!maybeTextureInfo) {
+      return;
+    }
+    const Texture* pTexture =
+        Model::getSafe(&model.textures, maybeTextureInfo->index);
+    if (pTexture && pTexture->source >= 0 &&
+        size_t(pTexture->source) < images.size()) {
+      images[size_t(pTexture->source)] = true;
+    }
+  };
+
+  for (const Material& material : model.materials) {
+    if (material.pbrMetallicRoughness) {
+      markImage(isBaseColor, material.pbrMetallicRoughness->baseColorTexture);
+      markImage(
+          isOther,
+          material.pbrMetallicRoughness->metallicRoughnessTexture);
+    }
+    markImage(isOther, material.normalTexture);
+    markImage(isOther, material.occlusionTexture);
+    markImage(isOther, material.emissiveTexture);
+  }
+
+  for (size_t i = 0; i < isBaseColor.size(); ++i) {
+    isBaseColor[i] = isBaseColor[i] && !isOther[i];
+  }
+  return isBaseColor;
+}
+
+/**
+ * @brief The result of the async part of mesh loading.
+ */
+struct LoadThreadResult {
+  System::Array1<UnityEngine::Mesh> meshes;
+  std::vector<MeshBatch> batches{};
+  std::vector<CesiumPrimitiveInfo> primitiveInfos{};
+};
+
+/**
+ * @brief A glTF primitive along with the transform of the node that
+ * instances it.
+ */
+struct PrimitiveToRender {
+  const MeshPrimitive* pPrimitive;
+  glm::dmat4 transform;
+  int64_t indexInMesh;
+};
+} // namespace
+
+/**
+ * @brief A tile whose game object has been created, but whose meshes have
+ * not all been given game objects yet.
+ */
+struct UnityPrepareRendererResources::PendingTile {
+  const Tile* pTile;
+  const Model* pModel;
+  CesiumGltfGameObject* pCesiumGameObject;
+  std::unique_ptr<LoadThreadResult> pLoadThreadResult;
+  glm::dmat4 tileTransform;
+  std::vector<PrimitiveToRender> primitivesToRender;
+  DotNet::CesiumForUnity::CesiumMetadata metadataComponent;
+
+  /**
+   * @brief The index of the next mesh to be finalized.
+   */
+  int32_t nextMeshIndex = 0;
+
+  /**
+   * @brief The priority of this tile, updated every frame. Tiles with a larger
+   * screen-space error, and then tiles that are closer, are finalized first.
+   */
+  double screenSpaceError = 0.0;
+  double distance = 0.0;
+};
+
+UnityPrepareRendererResources::UnityPrepareRendererResources(
+    const UnityEngine::GameObject& tileset)
+    : _tileset(tileset),
+      _shaderProperty(),
+      _combinePrimitives(false),
+      _vertexFormat(),
+      _compressTextures(false),
+      _pendingTiles(),
+      _materialCache(),
+      _propertyBlock(),
+      _renderState(),
+      _defaultMaterial(nullptr),
+      _defaultUnlitMaterial(nullptr) {
+  DotNet::CesiumForUnity::Cesium3DTileset tilesetComponent =
+      tileset.GetComponent<DotNet::CesiumForUnity::Cesium3DTileset>();
+  if (tilesetComponent != nullptr) {
+    // The tileset's overlays are not known until it is created.
+    this->updateRenderState(tilesetComponent, nullptr);
+
+    this->_combinePrimitives = tilesetComponent.combinePrimitives();
+    this->_vertexFormat.normalFormat = tilesetComponent.normalFormat();
+    this->_vertexFormat.texCoordFormat = tilesetComponent.texCoordFormat();
+
+    // Physics meshes can only be baked from 32-bit float positions.
+    this->_vertexFormat.quantizePositions =
+        tilesetComponent.quantizePositions() &&
+        !tilesetComponent.createPhysicsMeshes();
+
+    this->_compressTextures =
+        tilesetComponent.compressTextures() &&
+        TextureLoader::getSupportedGpuCompressedPixelFormats().BC1_RGB;
+  }
+}
+
+UnityPrepareRendererResources::~UnityPrepareRendererResources() = default;
+
+void UnityPrepareRendererResources::updateRenderState(
+    const DotNet::CesiumForUnity::Cesium3DTileset& tilesetComponent,
+    const Tileset* pTileset) {
+  CesiumTilesetRenderState& state = this->_renderState;
+
+  UnityEngine::Material opaqueMaterial = tilesetComponent.opaqueMaterial();
+  if (opaqueMaterial != nullptr) {
+    state.material = opaqueMaterial;
+    state.unlitMaterial = opaqueMaterial;
+  } else {
+    // The default materials never change, so only load them once.
+    if (this->_defaultMaterial == nullptr) {
+      this->_defaultMaterial =
+          UnityEngine::Resources::Load<UnityEngine::Material>(
+              System::String("CesiumDefaultTilesetMaterial"));
+    }
+    if (this->_defaultUnlitMaterial == nullptr) {
+      this->_defaultUnlitMaterial =
+          UnityEngine::Resources::Load<UnityEngine::Material>(
+              System::String("CesiumUnlitTilesetMaterial"));
+    }
+    state.material = this->_defaultMaterial;
+    state.unlitMaterial = this->_defaultUnlitMaterial;
+  }
+  state.materialInstanceID =
+      state.material != nullptr ? state.material.GetInstanceID() : 0;
+  state.unlitMaterialInstanceID = state.unlitMaterial != nullptr
+                                      ? state.unlitMaterial.GetInstanceID()
+                                      : 0;
+
+  if (tilesetComponent.showTilesInHierarchy()) {
+    state.gameObjectHideFlags = UnityEngine::HideFlags::DontSave;
+    state.meshHideFlags = UnityEngine::HideFlags::HideAndDontSave;
+  } else {
+    state.gameObjectHideFlags = UnityEngine::HideFlags::DontSave |
+                                UnityEngine::HideFlags::HideInHierarchy;
+    state.meshHideFlags = UnityEngine::HideFlags::HideAndDontSave |
+                          UnityEngine::HideFlags::HideInHierarchy;
+  }
+
+  state.createPhysicsMeshes = tilesetComponent.createPhysicsMeshes();
+  state.usePropertyBlocks =
+      UnityEngine::Rendering::GraphicsSettings::currentRenderPipeline() ==
+      nullptr;
+
+  state.overlayIndices.clear();
+  if (pTileset) {
+    uint32_t overlayIndex = 0;
+    for (const CesiumUtility::IntrusivePointer<RasterOverlay>& pOverlay :
+         pTileset->getOverlays()) {
+      state.overlayIndices.emplace(pOverlay.get(), overlayIndex++);
+    }
+  }
+  state.overlayCount = static_cast<uint32_t>(state.overlayIndices.size());
+}
 
-        // TODO: use sub-meshes for glTF primitives, instead of a separate mesh
-        // for each.
-        SubMeshDescriptor subMeshDescriptor{};
+std::optional<uint32_t>
+UnityPrepareRendererResources::getOverlayIndex(const RasterOverlay& overlay) {
+  std::unordered_map<const RasterOverlay*, uint32_t>& overlayIndices =
+      this->_renderState.overlayIndices;
+  auto it = overlayIndices.find(&overlay);
+  if (it != overlayIndices.end()) {
+    return it->second;
+  }
 
-        if (primitive.mode == MeshPrimitive::Mode::POINTS) {
-          subMeshDescriptor.topology = MeshTopology::Points;
-          primitiveInfo.containsPoints = true;
-        } else {
-          subMeshDescriptor.topology = MeshTopology::Triangles;
-        }
+  // The overlay was added since the render state was last updated.
+  DotNet::CesiumForUnity::Cesium3DTileset tilesetComponent =
+      this->_tileset.GetComponent<DotNet::CesiumForUnity::Cesium3DTileset>();
+  Tileset* pTileset = tilesetComponent.NativeImplementation().getTileset();
+  if (!pTileset)
+    return std::nullopt;
 
-        subMeshDescriptor.indexStart = 0;
-        subMeshDescriptor.indexCount = indexCount;
-        subMeshDescriptor.baseVertex = 0;
+  uint32_t overlayIndex = 0;
+  for (const CesiumUtility::IntrusivePointer<RasterOverlay>& pOverlay :
+       pTileset->getOverlays()) {
+    if (&overlay == pOverlay.get()) {
+      overlayIndices.emplace(&overlay, overlayIndex);
+      return overlayIndex;
+    }
 
-        // These are calculated automatically by SetSubMesh
-        subMeshDescriptor.firstVertex = 0;
-        subMeshDescriptor.vertexCount = 0;
+    ++overlayIndex;
+  }
 
-        meshData.SetSubMesh(0, subMeshDescriptor, MeshUpdateFlags::Default);
-      });
+  return std::nullopt;
 }
 
-/**
- * @brief The result of the async part of mesh loading.
- */
-struct LoadThreadResult {
-  System::Array1<UnityEngine::Mesh> meshes;
-  std::vector<CesiumPrimitiveInfo> primitiveInfos{};
-};
-} // namespace
-
-UnityPrepareRendererResources::UnityPrepareRendererResources(
-    const UnityEngine::GameObject& tileset)
-    : _tileset(tileset), _shaderProperty() {}
-
 CesiumAsync::Future<TileLoadResultAndRenderResources>
 UnityPrepareRendererResources::prepareInLoadThread(
     const CesiumAsync::AsyncSystem& asyncSystem,
@@ -558,98 +1401,140 @@ UnityPrepareRendererResources::prepareInLoadThread(
     return asyncSystem.createResolvedFuture(
         TileLoadResultAndRenderResources{std::move(tileLoadResult), nullptr});
 
-  int32_t numberOfPrimitives = countPrimitives(*pModel);
+  std::vector<MeshBatch> batches =
+      planMeshBatches(*pModel, this->_combinePrimitives);
+  int32_t numberOfMeshes = static_cast<int32_t>(batches.size());
 
   struct IntermediateLoadThreadResult {
     MeshDataResult meshDataResult;
     TileLoadResult tileLoadResult;
   };
 
-  return asyncSystem
-      .runInMainThread([numberOfPrimitives]() {
-        // Allocate a MeshDataArray for the primitives.
-        // Unfortunately, this must be done on the main thread.
-        return UnityEngine::Mesh::AllocateWritableMeshData(numberOfPrimitives);
-      })
+  // Writable mesh data can only be allocated on the main thread. Take what we
+  // can from the pool that the main thread refills every frame, and only wait
+  // for the main thread for the arrays the pool could not provide.
+  std::vector<UnityEngine::MeshDataArray> pooledMeshDataArrays;
+  const int32_t missing =
+      numberOfMeshes -
+      MeshDataArrayPool::take(numberOfMeshes, pooledMeshDataArrays);
+  CesiumAsync::Future<std::vector<UnityEngine::MeshDataArray>>
+      futureMeshDataArrays =
+          missing == 0
+              ? asyncSystem.createResolvedFuture(
+                    std::move(pooledMeshDataArrays))
+              : asyncSystem.runInMainThread(
+                    [missing,
+                     pooledMeshDataArrays =
+                         std::move(pooledMeshDataArrays)]() mutable {
+                      std::vector<UnityEngine::MeshDataArray> allocated =
+                          MeshDataArrayPool::allocate(missing);
+                      pooledMeshDataArrays.insert(
+                          pooledMeshDataArrays.end(),
+                          std::make_move_iterator(allocated.begin()),
+                          std::make_move_iterator(allocated.end()));
+                      return std::move(pooledMeshDataArrays);
+                    });
+
+  return std::move(futureMeshDataArrays)
       .thenInWorkerThread(
-          [tileLoadResult = std::move(tileLoadResult)](
-              UnityEngine::MeshDataArray&& meshDataArray) mutable {
-            MeshDataResult meshDataResult{std::move(meshDataArray), {}};
-            // Free the MeshDataArray if something goes wrong.
+          [tileLoadResult = std::move(tileLoadResult),
+           batches = std::move(batches),
+           vertexFormat = this->_vertexFormat,
+           compressTextures = this->_compressTextures](
+              std::vector<UnityEngine::MeshDataArray>&&
+                  meshDataArrays) mutable {
+            MeshDataResult meshDataResult{
+                std::move(meshDataArrays),
+                std::move(batches),
+                {}};
+            // Free the MeshDataArrays if something goes wrong.
             ScopeGuard sg([&meshDataResult]() {
-              meshDataResult.meshDataArray.Dispose();
+              for (UnityEngine::MeshDataArray& meshDataArray :
+                   meshDataResult.meshDataArrays) {
+                meshDataArray.Dispose();
+              }
             });
 
-            populateMeshDataArray(meshDataResult, tileLoadResult);
+            populateMeshDataArray(
+                meshDataResult,
+                tileLoadResult,
+                vertexFormat);
+
+            // Generate texture mips and compress textures here so that the
+            // main thread only has to copy them. Only base color images are
+            // compressed; compressToBC1 itself skips those with alpha.
+            CesiumGltf::Model* pModel =
+                std::get_if<CesiumGltf::Model>(&tileLoadResult.contentKind);
+            if (pModel) {
+              std::vector<bool> compressible;
+              if (compressTextures) {
+                compressible = findCompressibleImages(*pModel);
+              }
+              for (size_t i = 0; i < pModel->images.size(); ++i) {
+                ImageCesium& image = pModel->images[i].cesium;
+                ImageProcessing::generateMipMaps(image);
+                if (compressTextures && compressible[i]) {
+                  ImageProcessing::compressToBC1(image);
+                }
+              }
+            }
 
-            // We're returning the MeshDataArray, so don't free it.
+            // We're returning the MeshDataArrays, so don't free them.
             sg.release();
             return IntermediateLoadThreadResult{
                 std::move(meshDataResult),
                 std::move(tileLoadResult)};
           })
       .thenInMainThread(
-          [asyncSystem, tileset = this->_tileset](
+          [asyncSystem, this](
               IntermediateLoadThreadResult&& workerResult) mutable {
-            bool shouldCreatePhysicsMeshes = false;
-            bool shouldShowTilesInHierarchy = false;
-
-            DotNet::CesiumForUnity::Cesium3DTileset tilesetComponent =
-                tileset.GetComponent<DotNet::CesiumForUnity::Cesium3DTileset>();
-            if (tilesetComponent != nullptr) {
-              shouldCreatePhysicsMeshes =
-                  tilesetComponent.createPhysicsMeshes();
-              shouldShowTilesInHierarchy =
-                  tilesetComponent.showTilesInHierarchy();
-            }
+            // The tileset waits for its loads to finish before it is
+            // destroyed, so this is still alive here.
+            const CesiumTilesetRenderState& renderState = this->_renderState;
 
-            const UnityEngine::MeshDataArray& meshDataArray =
-                workerResult.meshDataResult.meshDataArray;
-            const std::vector<CesiumPrimitiveInfo>& primitiveInfos =
-                workerResult.meshDataResult.primitiveInfos;
+            const std::vector<UnityEngine::MeshDataArray>& meshDataArrays =
+                workerResult.meshDataResult.meshDataArrays;
+            const std::vector<MeshBatch>& batches =
+                workerResult.meshDataResult.batches;
 
             // Create meshes and populate them from the MeshData created in
             // the worker thread. Sadly, this must be done in the main
             // thread, too.
-            System::Array1<UnityEngine::Mesh> meshes(meshDataArray.Length());
+            System::Array1<UnityEngine::Mesh> meshes(
+                static_cast<int32_t>(meshDataArrays.size()));
             for (int32_t i = 0, len = meshes.Length(); i < len; ++i) {
               UnityEngine::Mesh unityMesh{};
 
               // Don't let Unity unload this mesh during the time in between
               // when we create it and when we attach it to a GameObject.
-              if (shouldShowTilesInHierarchy) {
-                unityMesh.hideFlags(UnityEngine::HideFlags::HideAndDontSave);
-              } else {
-                unityMesh.hideFlags(
-                    UnityEngine::HideFlags::HideAndDontSave |
-                    UnityEngine::HideFlags::HideInHierarchy);
-              }
+              unityMesh.hideFlags(renderState.meshHideFlags);
 
               meshes.Item(i, unityMesh);
             }
 
-            // TODO: Validate indices in the worker thread, and then ask Unity
-            // not to do it here by setting
-            // MeshUpdateFlags::DontValidateIndices.
-            UnityEngine::Mesh::ApplyAndDisposeWritableMeshData(
-                meshDataArray,
-                meshes,
-                UnityEngine::Rendering::MeshUpdateFlags::Default);
-
-            // TODO: we should be able to do this in the worker thread, even if
-            // we have to do it manually.
+            // Indices were validated and bounds were computed in the worker
+            // thread, so don't make Unity do it again here.
             for (int32_t i = 0, len = meshes.Length(); i < len; ++i) {
-              meshes[i].RecalculateBounds();
+              UnityEngine::Mesh::ApplyAndDisposeWritableMeshData(
+                  meshDataArrays[i],
+                  meshes[i],
+                  UnityEngine::Rendering::MeshUpdateFlags::
+                          DontRecalculateBounds |
+                      UnityEngine::Rendering::MeshUpdateFlags::
+                          DontValidateIndices);
+              meshes[i].bounds(createBounds(
+                  batches[i].boundsMinimum,
+                  batches[i].boundsMaximum));
             }
 
-            if (shouldCreatePhysicsMeshes) {
+            if (renderState.createPhysicsMeshes) {
               // Baking physics meshes takes awhile, so do that in a
               // worker thread.
               const std::int32_t len = meshes.Length();
               std::vector<std::int32_t> instanceIDs;
               for (int32_t i = 0; i < len; ++i) {
                 // Don't attempt to bake a physics mesh from a point cloud.
-                if (primitiveInfos[i].containsPoints) {
+                if (batches[i].containsPoints) {
                   continue;
                 }
                 instanceIDs.push_back(meshes[i].GetInstanceID());
@@ -666,6 +1551,7 @@ UnityPrepareRendererResources::prepareInLoadThread(
 
                       LoadThreadResult* pResult = new LoadThreadResult{
                           std::move(meshes),
+                          std::move(workerResult.meshDataResult.batches),
                           std::move(
                               workerResult.meshDataResult.primitiveInfos)};
                       return TileLoadResultAndRenderResources{
@@ -677,6 +1563,7 @@ UnityPrepareRendererResources::prepareInLoadThread(
 
             LoadThreadResult* pResult = new LoadThreadResult{
                 std::move(meshes),
+                std::move(workerResult.meshDataResult.batches),
                 std::move(workerResult.meshDataResult.primitiveInfos)};
             return asyncSystem.createResolvedFuture(
                 TileLoadResultAndRenderResources{
@@ -685,16 +1572,420 @@ UnityPrepareRendererResources::prepareInLoadThread(
           });
 }
 
+namespace {
+
+void applyRasterOverlay(
+    UnityEngine::MaterialPropertyBlock& propertyBlock,
+    const CesiumPrimitiveInfo& primitiveInfo,
+    const CesiumRasterOverlayAttachment& attachment,
+    CesiumShaderProperties& shaderProperty) {
+  // Note: The overlay texture coordinate index corresponds to the glTF
+  // attribute _CESIUMOVERLAY_<i>. Here we retrieve the Unity texture
+  // coordinate index corresponding to the glTF texture coordinate index
+  // for this primitive.
+  auto texCoordIndexIt = primitiveInfo.rasterOverlayUvIndexMap.find(
+      attachment.overlayTextureCoordinateID);
+  if (texCoordIndexIt == primitiveInfo.rasterOverlayUvIndexMap.end()) {
+    // The associated UV coords for this overlay are missing.
+    // TODO: log warning?
+    return;
+  }
+
+  // Note: The overlay index is NOT the same as the overlay texture
+  // coordinate index. For instance, multiple overlays could point to the
+  // same overlay UV index - multiple overlays can use the _CESIUMOVERLAY_0
+  // attribute for example. The _CESIUMOVERLAY_<i> attributes correspond to
+  // unique _projections_, not unique overlays.
+  propertyBlock.SetFloat(
+      shaderProperty.getOverlayTextureCoordinateIndexID(
+          attachment.overlayIndex),
+      static_cast<float>(texCoordIndexIt->second));
+
+  propertyBlock.SetTexture(
+      shaderProperty.getOverlayTextureID(attachment.overlayIndex),
+      attachment.texture);
+
+  propertyBlock.SetVector(
+      shaderProperty.getOverlayTranslationAndScaleID(attachment.overlayIndex),
+      attachment.translationAndScale);
+}
+
+void applyRasterOverlay(
+    MaterialKey& key,
+    const CesiumPrimitiveInfo& primitiveInfo,
+    const CesiumRasterOverlayAttachment& attachment,
+    CesiumShaderProperties& shaderProperty) {
+  auto texCoordIndexIt = primitiveInfo.rasterOverlayUvIndexMap.find(
+      attachment.overlayTextureCoordinateID);
+  if (texCoordIndexIt == primitiveInfo.rasterOverlayUvIndexMap.end()) {
+    return;
+  }
+
+  key.setFloat(
+      shaderProperty.getOverlayTextureCoordinateIndexID(
+          attachment.overlayIndex),
+      static_cast<float>(texCoordIndexIt->second));
+
+  key.setTexture(
+      shaderProperty.getOverlayTextureID(attachment.overlayIndex),
+      attachment.texture);
+
+  const UnityEngine::Vector4& translationAndScale =
+      attachment.translationAndScale;
+  key.setVector(
+      shaderProperty.getOverlayTranslationAndScaleID(attachment.overlayIndex),
+      glm::vec4(
+          translationAndScale.x,
+          translationAndScale.y,
+          translationAndScale.z,
+          translationAndScale.w));
+}
+
+/**
+ * @brief Loads a glTF texture for a primitive and records it, along with the
+ * Unity texture coordinate index it uses, if the primitive has the texture
+ * coordinates the texture refers to.
+ *
+ * Each glTF texture is only loaded once per tile, however many primitives
+ * use it.
+ *
+ * @returns true if the texture was loaded.
+ */
+bool loadPrimitiveTexture(
+    const Model& gltf,
+    const TextureInfo& textureInfo,
+    int32_t textureID,
+    int32_t textureCoordinateIndexID,
+    std::unordered_map<int32_t, UnityEngine::Texture>& textureCache,
+    CesiumPrimitiveInfo& primitiveInfo,
+    MaterialKey& key) {
+  auto texCoordIndexIt = primitiveInfo.uvIndexMap.find(textureInfo.texCoord);
+  if (texCoordIndexIt == primitiveInfo.uvIndexMap.end()) {
+    return false;
+  }
+
+  auto textureIt = textureCache.find(textureInfo.index);
+  if (textureIt == textureCache.end()) {
+    // Remember textures that failed to load, too, so they are not retried
+    // for every primitive.
+    textureIt =
+        textureCache
+            .emplace(
+                textureInfo.index,
+                TextureLoader::loadTexture(gltf, textureInfo.index))
+            .first;
+  }
+
+  const UnityEngine::Texture& texture = textureIt->second;
+  if (texture == nullptr) {
+    return false;
+  }
+
+  primitiveInfo.textures.emplace_back(
+      CesiumPrimitiveTexture{textureID, texture});
+  key.setFloat(
+      textureCoordinateIndexID,
+      static_cast<float>(texCoordIndexIt->second));
+  return true;
+}
+
+/**
+ * @brief Resolves the material parameters of a primitive and loads its
+ * textures. The textures and the parameters other than the textures are
+ * stored in the primitive info.
+ */
+void resolveMaterial(
+    const CesiumTilesetRenderState& renderState,
+    CesiumShaderProperties& shaderProperty,
+    const Model& gltf,
+    const MeshPrimitive& primitive,
+    std::unordered_map<int32_t, UnityEngine::Texture>& textureCache,
+    CesiumPrimitiveInfo& primitiveInfo) {
+  const Material* pMaterial =
+      Model::getSafe(&gltf.materials, primitive.material);
+
+  const bool isUnlit =
+      pMaterial && pMaterial->hasExtension<ExtensionKhrMaterialsUnlit>();
+
+  MaterialKey key;
+  key.baseMaterialInstanceID = isUnlit ? renderState.unlitMaterialInstanceID
+                                       : renderState.materialInstanceID;
+
+  if (pMaterial) {
+    if (pMaterial->pbrMetallicRoughness) {
+      // Add base color factor and metallic-roughness factor regardless of
+      // if the textures are present.
+      const std::vector<double>& baseColorFactorSrc =
+          pMaterial->pbrMetallicRoughness->baseColorFactor;
+      glm::vec4 baseColorFactor(1.0f);
+      for (size_t i = 0; i < baseColorFactorSrc.size() && i < 4; ++i) {
+        baseColorFactor[glm::length_t(i)] =
+            static_cast<float>(baseColorFactorSrc[i]);
+      }
+      key.setVector(shaderProperty.getBaseColorFactorID(), baseColorFactor);
+
+      key.setVector(
+          shaderProperty.getMetallicRoughnessFactorID(),
+          glm::vec4(
+              static_cast<float>(
+                  pMaterial->pbrMetallicRoughness->metallicFactor),
+              static_cast<float>(
+                  pMaterial->pbrMetallicRoughness->roughnessFactor),
+              0.0f,
+              0.0f));
+
+      const std::optional<TextureInfo>& baseColorTexture =
+          pMaterial->pbrMetallicRoughness->baseColorTexture;
+      if (baseColorTexture) {
+        loadPrimitiveTexture(
+            gltf,
+            *baseColorTexture,
+            shaderProperty.getBaseColorTextureID(),
+            shaderProperty.getBaseColorTextureCoordinateIndexID(),
+            textureCache,
+            primitiveInfo,
+            key);
+      }
+
+      const std::optional<TextureInfo>& metallicRoughness =
+          pMaterial->pbrMetallicRoughness->metallicRoughnessTexture;
+      if (metallicRoughness) {
+        loadPrimitiveTexture(
+            gltf,
+            *metallicRoughness,
+            shaderProperty.getMetallicRoughnessTextureID(),
+            shaderProperty.getMetallicRoughnessTextureCoordinateIndexID(),
+            textureCache,
+            primitiveInfo,
+            key);
+      }
+    }
+
+    if (pMaterial->normalTexture &&
+        loadPrimitiveTexture(
+            gltf,
+            *pMaterial->normalTexture,
+            shaderProperty.getNormalMapTextureID(),
+            shaderProperty.getNormalMapTextureCoordinateIndexID(),
+            textureCache,
+            primitiveInfo,
+            key)) {
+      key.setFloat(
+          shaderProperty.getNormalMapScaleID(),
+          static_cast<float>(pMaterial->normalTexture->scale));
+    }
+
+    if (pMaterial->occlusionTexture &&
+        loadPrimitiveTexture(
+            gltf,
+            *pMaterial->occlusionTexture,
+            shaderProperty.getOcclusionTextureID(),
+            shaderProperty.getOcclusionTextureCoordinateIndexID(),
+            textureCache,
+            primitiveInfo,
+            key)) {
+      key.setFloat(
+          shaderProperty.getOcclusionStrengthID(),
+          static_cast<float>(pMaterial->occlusionTexture->strength));
+    }
+
+    const std::vector<double>& emissiveFactorSrc = pMaterial->emissiveFactor;
+    glm::vec4 emissiveFactor(0.0f);
+    for (size_t i = 0; i < emissiveFactorSrc.size() && i < 3; ++i) {
+      emissiveFactor[glm::length_t(i)] =
+          static_cast<float>(emissiveFactorSrc[i]);
+    }
+    key.setVector(shaderProperty.getEmissiveFactorID(), emissiveFactor);
+
+    if (pMaterial->emissiveTexture) {
+      loadPrimitiveTexture(
+          gltf,
+          *pMaterial->emissiveTexture,
+          shaderProperty.getEmissiveTextureID(),
+          shaderProperty.getEmissiveTextureCoordinateIndexID(),
+          textureCache,
+          primitiveInfo,
+          key);
+    }
+  }
+
+  // Initialize overlay UVs to all use index 0, attachRasterTile will
+  // update the property block with the correct UV index.
+  for (uint32_t i = 0; i < renderState.overlayCount; ++i) {
+    key.setFloat(shaderProperty.getOverlayTextureCoordinateIndexID(i), 0.0f);
+  }
+
+  primitiveInfo.materialKey = std::move(key);
+}
+
+/**
+ * @brief Gets a shared material for a primitive from the cache, adding a
+ * reference to it.
+ *
+ * With property blocks, only the parameters that are not textures decide
+ * which material is used. Otherwise the primitive's textures and attached
+ * raster overlays are set on the material, too.
+ */
+UnityEngine::Material acquirePrimitiveMaterial(
+    const CesiumTilesetRenderState& renderState,
+    CesiumShaderProperties& shaderProperty,
+    MaterialCache& materialCache,
+    const CesiumPrimitiveInfo& primitiveInfo,
+    const std::vector<CesiumRasterOverlayAttachment>& attachments) {
+  const MaterialKey& baseKey = primitiveInfo.materialKey;
+  const UnityEngine::Material& baseMaterial =
+      baseKey.baseMaterialInstanceID == renderState.unlitMaterialInstanceID
+          ? renderState.unlitMaterial
+          : renderState.material;
+
+  if (renderState.usePropertyBlocks) {
+    return materialCache.acquire(baseKey, baseMaterial);
+  }
+
+  MaterialKey key = baseKey;
+  for (const CesiumPrimitiveTexture& texture : primitiveInfo.textures) {
+    key.setTexture(texture.propertyID, texture.texture);
+  }
+  for (const CesiumRasterOverlayAttachment& attachment : attachments) {
+    applyRasterOverlay(key, primitiveInfo, attachment, shaderProperty);
+  }
+  return materialCache.acquire(key, baseMaterial);
+}
+
+/**
+ * @brief Sets the textures and attached raster overlays of a primitive on its
+ * renderer, replacing any that were set before.
+ */
+void updatePropertyBlock(
+    UnityEngine::MaterialPropertyBlock& propertyBlock,
+    const UnityEngine::MeshRenderer& meshRenderer,
+    const CesiumPrimitiveInfo& primitiveInfo,
+    const std::vector<CesiumRasterOverlayAttachment>& attachments,
+    CesiumShaderProperties& shaderProperty) {
+  propertyBlock.Clear();
+
+  for (const CesiumPrimitiveTexture& texture : primitiveInfo.textures) {
+    propertyBlock.SetTexture(texture.propertyID, texture.texture);
+  }
+
+  for (const CesiumRasterOverlayAttachment& attachment : attachments) {
+    applyRasterOverlay(
+        propertyBlock,
+        primitiveInfo,
+        attachment,
+        shaderProperty);
+  }
+
+  meshRenderer.SetPropertyBlock(propertyBlock, primitiveInfo.subMeshIndex);
+}
+
+/**
+ * @brief Applies the raster overlays attached to a glTF to all of its
+ * primitives that have been given a game object, either with property blocks
+ * or by switching to materials that include the overlays.
+ */
+void updateRasterOverlays(
+    const CesiumTilesetRenderState& renderState,
+    UnityEngine::MaterialPropertyBlock& propertyBlock,
+    CesiumShaderProperties& shaderProperty,
+    MaterialCache& materialCache,
+    const CesiumGltfGameObject& cesiumGameObject) {
+  const std::vector<UnityEngine::MeshRenderer>& meshRenderers =
+      cesiumGameObject.meshRenderers;
+
+  if (!renderState.usePropertyBlocks) {
+    // The new materials are acquired before the old ones are released, so
+    // that materials that did not change are not destroyed and recreated.
+    for (size_t i = 0; i < meshRenderers.size(); ++i) {
+      const UnityEngine::MeshRenderer& meshRenderer = meshRenderers[i];
+      if (meshRenderer == nullptr)
+        continue;
+
+      System::Array1<UnityEngine::Material> oldMaterials =
+          meshRenderer.sharedMaterials();
+      System::Array1<UnityEngine::Material> newMaterials(
+          oldMaterials.Length());
+      for (const CesiumPrimitiveInfo& primitiveInfo :
+           cesiumGameObject.primitiveInfos) {
+        if (primitiveInfo.meshIndex != static_cast<int32_t>(i) ||
+            primitiveInfo.subMeshIndex >= newMaterials.Length())
+          continue;
+
+        newMaterials.Item(
+            primitiveInfo.subMeshIndex,
+            acquirePrimitiveMaterial(
+                renderState,
+                shaderProperty,
+                materialCache,
+                primitiveInfo,
+                cesiumGameObject.rasterAttachments));
+      }
+      meshRenderer.sharedMaterials(newMaterials);
+
+      for (int32_t j = 0, len = oldMaterials.Length(); j < len; ++j) {
+        UnityEngine::Material material = oldMaterials[j];
+        if (material != nullptr)
+          materialCache.release(material);
+      }
+    }
+    return;
+  }
+
+  for (const CesiumPrimitiveInfo& primitiveInfo :
+       cesiumGameObject.primitiveInfos) {
+    // Primitives whose mesh is still pending have no renderer yet.
+    if (primitiveInfo.meshIndex < 0 ||
+        primitiveInfo.meshIndex >= static_cast<int32_t>(meshRenderers.size()))
+      continue;
+
+    const UnityEngine::MeshRenderer& meshRenderer =
+        meshRenderers[primitiveInfo.meshIndex];
+    if (meshRenderer == nullptr)
+      continue;
+
+    updatePropertyBlock(
+        propertyBlock,
+        meshRenderer,
+        primitiveInfo,
+        cesiumGameObject.rasterAttachments,
+        shaderProperty);
+  }
+}
+
+/**
+ * @brief Computes the largest screen-space error of a tile from any of the
+ * given views, along with the distance from the closest view.
+ */
+void computeFinalizationPriority(
+    const std::vector<ViewState>& viewStates,
+    const Tile& tile,
+    double& screenSpaceError,
+    double& distance) {
+  screenSpaceError = 0.0;
+  distance = std::numeric_limits<double>::max();
+
+  for (const ViewState& viewState : viewStates) {
+    double viewDistance = glm::sqrt(glm::max(
+        viewState.computeDistanceSquaredToBoundingVolume(
+            tile.getBoundingVolume()),
+        0.0));
+    screenSpaceError = std::max(
+        screenSpaceError,
+        viewState.computeScreenSpaceError(
+            tile.getGeometricError(),
+            viewDistance));
+    distance = std::min(distance, viewDistance);
+  }
+}
+
+} // namespace
+
 void* UnityPrepareRendererResources::prepareInMainThread(
     Cesium3DTilesSelection::Tile& tile,
     void* pLoadThreadResult_) {
   std::unique_ptr<LoadThreadResult> pLoadThreadResult(
       static_cast<LoadThreadResult*>(pLoadThreadResult_));
 
-  const System::Array1<UnityEngine::Mesh>& meshes = pLoadThreadResult->meshes;
-  const std::vector<CesiumPrimitiveInfo>& primitiveInfos =
-      pLoadThreadResult->primitiveInfos;
-
   const Cesium3DTilesSelection::TileContent& content = tile.getContent();
   const Cesium3DTilesSelection::TileRenderContent* pRenderContent =
       content.getRenderContent();
@@ -710,25 +2001,9 @@ void* UnityPrepareRendererResources::prepareInMainThread(
     name = urlIt->second.getStringOrDefault("glTF");
   }
 
-  DotNet::CesiumForUnity::Cesium3DTileset tilesetComponent =
-      this->_tileset.GetComponent<DotNet::CesiumForUnity::Cesium3DTileset>();
-
-  uint32_t currentOverlayCount =
-      static_cast<uint32_t>(tilesetComponent.NativeImplementation()
-                                .getTileset()
-                                ->getOverlays()
-                                .size());
-
   auto pModelGameObject =
       std::make_unique<UnityEngine::GameObject>(System::String(name));
-
-  if (tilesetComponent.showTilesInHierarchy()) {
-    pModelGameObject->hideFlags(UnityEngine::HideFlags::DontSave);
-  } else {
-    pModelGameObject->hideFlags(
-        UnityEngine::HideFlags::DontSave |
-        UnityEngine::HideFlags::HideInHierarchy);
-  }
+  pModelGameObject->hideFlags(this->_renderState.gameObjectHideFlags);
 
   pModelGameObject->transform().SetParent(this->_tileset.transform(), false);
   pModelGameObject->SetActive(false);
@@ -737,22 +2012,6 @@ void* UnityPrepareRendererResources::prepareInMainThread(
   tileTransform = GltfUtilities::applyRtcCenter(model, tileTransform);
   tileTransform = GltfUtilities::applyGltfUpAxisTransform(model, tileTransform);
 
-  DotNet::CesiumForUnity::CesiumGeoreference georeferenceComponent =
-      this->_tileset
-          .GetComponentInParent<DotNet::CesiumForUnity::CesiumGeoreference>();
-
-  const LocalHorizontalCoordinateSystem* pCoordinateSystem = nullptr;
-  if (georeferenceComponent != nullptr) {
-    pCoordinateSystem =
-        &georeferenceComponent.NativeImplementation().getCoordinateSystem(
-            georeferenceComponent);
-  }
-
-  const bool createPhysicsMeshes = tilesetComponent.createPhysicsMeshes();
-  const bool showTilesInHierarchy = tilesetComponent.showTilesInHierarchy();
-
-  size_t meshIndex = 0;
-
   DotNet::CesiumForUnity::CesiumMetadata pMetadataComponent = nullptr;
   if (model.getExtension<ExtensionModelExtFeatureMetadata>()) {
     pMetadataComponent =
@@ -764,287 +2023,223 @@ void* UnityPrepareRendererResources::prepareInMainThread(
     }
   }
 
+  // The primitives are visited in the same order as in the load thread, so
+  // the index into primitiveInfos lines up.
+  std::vector<PrimitiveToRender> primitivesToRender;
+  primitivesToRender.reserve(pLoadThreadResult->primitiveInfos.size());
   model.forEachPrimitiveInScene(
       -1,
-      [&meshes,
-       &primitiveInfos,
-       &pModelGameObject,
-       &tileTransform,
-       &meshIndex,
-       &tilesetComponent,
-       pCoordinateSystem,
-       createPhysicsMeshes,
-       showTilesInHierarchy,
-       currentOverlayCount,
-       &pMetadataComponent,
-       &shaderProperty = _shaderProperty](
+      [&primitivesToRender](
           const Model& gltf,
           const Node& node,
           const Mesh& mesh,
           const MeshPrimitive& primitive,
           const glm::dmat4& transform) {
-        const CesiumPrimitiveInfo& primitiveInfo = primitiveInfos[meshIndex];
-        UnityEngine::Mesh unityMesh = meshes[meshIndex++];
-        if (unityMesh == nullptr) {
-          // This indicates Unity destroyed the mesh already, which really
-          // shouldn't happen.
-          return;
-        }
+        primitivesToRender.emplace_back(PrimitiveToRender{
+            &primitive,
+            transform,
+            &primitive - &mesh.primitives[0]});
+      });
 
-        auto positionAccessorIt = primitive.attributes.find("POSITION");
-        if (positionAccessorIt == primitive.attributes.end()) {
-          // This primitive doesn't have a POSITION semantic, ignore it.
-          return;
-        }
+  CesiumGltfGameObject* pCesiumGameObject = new CesiumGltfGameObject{
+      std::move(pModelGameObject),
+      std::move(pLoadThreadResult->primitiveInfos)};
 
-        int32_t positionAccessorID = positionAccessorIt->second;
-        AccessorView<UnityEngine::Vector3> positionView(
-            gltf,
-            positionAccessorID);
-        if (positionView.status() != AccessorViewStatus::Valid) {
-          // TODO: report invalid accessor
-          return;
-        }
+  // Creating the materials, textures, and game objects of a tile is
+  // expensive, so it is done one mesh at a time by finalizeTiles, within a
+  // per-frame time budget.
+  if (pLoadThreadResult->meshes.Length() > 0) {
+    pCesiumGameObject->pending = true;
+    this->_pendingTiles.emplace_back(std::make_unique<PendingTile>(PendingTile{
+        &tile,
+        &model,
+        pCesiumGameObject,
+        std::move(pLoadThreadResult),
+        tileTransform,
+        std::move(primitivesToRender),
+        pMetadataComponent}));
+  }
 
-        int64_t primitiveIndex = &mesh.primitives[0] - &primitive;
-        UnityEngine::GameObject primitiveGameObject(
-            System::String("Primitive " + std::to_string(primitiveIndex)));
-        if (showTilesInHierarchy) {
-          primitiveGameObject.hideFlags(UnityEngine::HideFlags::DontSave);
-        } else {
-          primitiveGameObject.hideFlags(
-              UnityEngine::HideFlags::DontSave |
-              UnityEngine::HideFlags::HideInHierarchy);
-        }
+  return pCesiumGameObject;
+}
 
-        primitiveGameObject.transform().parent(pModelGameObject->transform());
-
-        glm::dmat4 modelToEcef = tileTransform * transform;
-
-        CesiumForUnity::CesiumGlobeAnchor anchor =
-            primitiveGameObject
-                .AddComponent<CesiumForUnity::CesiumGlobeAnchor>();
-        anchor.detectTransformChanges(false);
-        anchor.adjustOrientationForGlobeWhenMoving(false);
-        anchor.localToGlobeFixedMatrix(
-            UnityTransforms::toUnityMathematics(modelToEcef));
-
-        UnityEngine::MeshFilter meshFilter =
-            primitiveGameObject.AddComponent<UnityEngine::MeshFilter>();
-        UnityEngine::MeshRenderer meshRenderer =
-            primitiveGameObject.AddComponent<UnityEngine::MeshRenderer>();
-
-        const Material* pMaterial =
-            Model::getSafe(&gltf.materials, primitive.material);
-
-        UnityEngine::Material opaqueMaterial =
-            tilesetComponent.opaqueMaterial();
-        if (opaqueMaterial == nullptr) {
-          if (pMaterial &&
-              pMaterial->hasExtension<ExtensionKhrMaterialsUnlit>()) {
-            opaqueMaterial =
-                UnityEngine::Resources::Load<UnityEngine::Material>(
-                    System::String("CesiumUnlitTilesetMaterial"));
-          } else {
-            opaqueMaterial =
-                UnityEngine::Resources::Load<UnityEngine::Material>(
-                    System::String("CesiumDefaultTilesetMaterial"));
-          }
-        }
+void UnityPrepareRendererResources::finalizeTiles(
+    const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+    double timeLimitMilliseconds) {
+  if (this->_pendingTiles.empty())
+    return;
 
-        UnityEngine::Material material =
-            UnityEngine::Object::Instantiate(opaqueMaterial);
-        material.hideFlags(UnityEngine::HideFlags::HideAndDontSave);
-        meshRenderer.material(material);
-
-        if (pMaterial) {
-          if (pMaterial->pbrMetallicRoughness) {
-            // Add base color factor and metallic-roughness factor regardless of
-            // if the textures are present.
-            const std::vector<double>& baseColorFactorSrc =
-                pMaterial->pbrMetallicRoughness->baseColorFactor;
-            UnityEngine::Vector4 baseColorFactor;
-            baseColorFactor.x = baseColorFactorSrc.size() > 0
-                                    ? static_cast<float>(baseColorFactorSrc[0])
-                                    : 1.0f;
-            baseColorFactor.y = baseColorFactorSrc.size() > 1
-                                    ? static_cast<float>(baseColorFactorSrc[1])
-                                    : 1.0f;
-            baseColorFactor.z = baseColorFactorSrc.size() > 2
-                                    ? static_cast<float>(baseColorFactorSrc[2])
-                                    : 1.0f;
-            baseColorFactor.w = baseColorFactorSrc.size() > 3
-                                    ? static_cast<float>(baseColorFactorSrc[3])
-                                    : 1.0f;
-            material.SetVector(
-                shaderProperty.getBaseColorFactorID(),
-                baseColorFactor);
-
-            UnityEngine::Vector4 metallicRoughnessFactor;
-            metallicRoughnessFactor.x =
-                pMaterial->pbrMetallicRoughness->metallicFactor;
-            metallicRoughnessFactor.y =
-                pMaterial->pbrMetallicRoughness->roughnessFactor;
-            material.SetVector(
-                shaderProperty.getMetallicRoughnessFactorID(),
-                metallicRoughnessFactor);
-
-            const std::optional<TextureInfo>& baseColorTexture =
-                pMaterial->pbrMetallicRoughness->baseColorTexture;
-            if (baseColorTexture) {
-              auto texCoordIndexIt =
-                  primitiveInfo.uvIndexMap.find(baseColorTexture->texCoord);
-              if (texCoordIndexIt != primitiveInfo.uvIndexMap.end()) {
-                UnityEngine::Texture texture =
-                    TextureLoader::loadTexture(gltf, baseColorTexture->index);
-                if (texture != nullptr) {
-                  material.SetTexture(
-                      shaderProperty.getBaseColorTextureID(),
-                      texture);
-                  material.SetFloat(
-                      shaderProperty.getBaseColorTextureCoordinateIndexID(),
-                      static_cast<float>(texCoordIndexIt->second));
-                }
-              }
-            }
+  const auto start = std::chrono::steady_clock::now();
+
+  // Finalize the tiles with the largest screen-space error first, because
+  // they are the most noticeable. Tiles with equal error, such as leaves, are
+  // finalized closest first.
+  for (const std::unique_ptr<PendingTile>& pPendingTile :
+       this->_pendingTiles) {
+    computeFinalizationPriority(
+        viewStates,
+        *pPendingTile->pTile,
+        pPendingTile->screenSpaceError,
+        pPendingTile->distance);
+  }
 
-            const std::optional<TextureInfo>& metallicRoughness =
-                pMaterial->pbrMetallicRoughness->metallicRoughnessTexture;
-            if (metallicRoughness) {
-              auto texCoordIndexIt =
-                  primitiveInfo.uvIndexMap.find(metallicRoughness->texCoord);
-              if (texCoordIndexIt != primitiveInfo.uvIndexMap.end()) {
-                UnityEngine::Texture texture =
-                    TextureLoader::loadTexture(gltf, metallicRoughness->index);
-                if (texture != nullptr) {
-                  material.SetTexture(
-                      shaderProperty.getMetallicRoughnessTextureID(),
-                      texture);
-                  material.SetFloat(
-                      shaderProperty
-                          .getMetallicRoughnessTextureCoordinateIndexID(),
-                      static_cast<float>(texCoordIndexIt->second));
-                }
-              }
-            }
-          }
+  std::stable_sort(
+      this->_pendingTiles.begin(),
+      this->_pendingTiles.end(),
+      [](const std::unique_ptr<PendingTile>& pLeft,
+         const std::unique_ptr<PendingTile>& pRight) {
+        if (pLeft->screenSpaceError != pRight->screenSpaceError)
+          return pLeft->screenSpaceError > pRight->screenSpaceError;
+        return pLeft->distance < pRight->distance;
+      });
 
-          if (pMaterial->normalTexture) {
-            auto texCoordIndexIt = primitiveInfo.uvIndexMap.find(
-                pMaterial->normalTexture->texCoord);
-            if (texCoordIndexIt != primitiveInfo.uvIndexMap.end()) {
-              UnityEngine::Texture texture = TextureLoader::loadTexture(
-                  gltf,
-                  pMaterial->normalTexture->index);
-              if (texture != nullptr) {
-                material.SetTexture(
-                    shaderProperty.getNormalMapTextureID(),
-                    texture);
-                material.SetFloat(
-                    shaderProperty.getNormalMapTextureCoordinateIndexID(),
-                    static_cast<float>(texCoordIndexIt->second));
-                material.SetFloat(
-                    shaderProperty.getNormalMapScaleID(),
-                    static_cast<float>(pMaterial->normalTexture->scale));
-              }
-            }
-          }
+  // Always finalize at least one mesh so that progress is made even when a
+  // single mesh takes longer than the time limit. A limit of zero or less
+  // means there is no limit, as with the tileset's other time limits.
+  const bool hasTimeLimit = timeLimitMilliseconds > 0.0;
+  auto it = this->_pendingTiles.begin();
+  do {
+    PendingTile& pendingTile = **it;
+    this->finalizeMesh(pendingTile);
+    if (pendingTile.nextMeshIndex >=
+        pendingTile.pLoadThreadResult->meshes.Length()) {
+      pendingTile.pCesiumGameObject->pending = false;
+      it = this->_pendingTiles.erase(it);
+    }
+  } while (it != this->_pendingTiles.end() &&
+           (!hasTimeLimit || std::chrono::duration<double, std::milli>(
+                                 std::chrono::steady_clock::now() - start)
+                                     .count() < timeLimitMilliseconds));
+}
 
-          if (pMaterial->occlusionTexture) {
-            auto texCoordIndexIt = primitiveInfo.uvIndexMap.find(
-                pMaterial->occlusionTexture->texCoord);
-            if (texCoordIndexIt != primitiveInfo.uvIndexMap.end()) {
-              UnityEngine::Texture texture = TextureLoader::loadTexture(
-                  gltf,
-                  pMaterial->occlusionTexture->index);
-              if (texture != nullptr) {
-                material.SetTexture(
-                    shaderProperty.getOcclusionTextureID(),
-                    texture);
-                material.SetFloat(
-                    shaderProperty.getOcclusionTextureCoordinateIndexID(),
-                    static_cast<float>(texCoordIndexIt->second));
-                material.SetFloat(
-                    shaderProperty.getOcclusionStrengthID(),
-                    static_cast<float>(pMaterial->occlusionTexture->strength));
-              }
-            }
-          }
+void UnityPrepareRendererResources::finalizeMesh(PendingTile& pendingTile) {
+  const CesiumTilesetRenderState& renderState = this->_renderState;
 
-          const std::vector<double>& emissiveFactorSrc =
-              pMaterial->emissiveFactor;
-          UnityEngine::Vector4 emissiveFactor;
-          emissiveFactor.x = emissiveFactorSrc.size() > 0
-                                 ? static_cast<float>(emissiveFactorSrc[0])
-                                 : 0.0f;
-          emissiveFactor.y = emissiveFactorSrc.size() > 1
-                                 ? static_cast<float>(emissiveFactorSrc[1])
-                                 : 0.0f;
-          emissiveFactor.z = emissiveFactorSrc.size() > 2
-                                 ? static_cast<float>(emissiveFactorSrc[2])
-                                 : 0.0f;
-          material.SetVector(
-              shaderProperty.getEmissiveFactorID(),
-              emissiveFactor);
-          if (pMaterial->emissiveTexture) {
-            auto texCoordIndexIt = primitiveInfo.uvIndexMap.find(
-                pMaterial->emissiveTexture->texCoord);
-            if (texCoordIndexIt != primitiveInfo.uvIndexMap.end()) {
-              UnityEngine::Texture texture = TextureLoader::loadTexture(
-                  gltf,
-                  pMaterial->emissiveTexture->index);
-              if (texture != nullptr) {
-                material.SetTexture(
-                    shaderProperty.getEmissiveTextureID(),
-                    texture);
-                material.SetFloat(
-                    shaderProperty.getEmissiveTextureCoordinateIndexID(),
-                    static_cast<float>(texCoordIndexIt->second));
-              }
-            }
-          }
-        }
+  const int32_t meshIndex = pendingTile.nextMeshIndex++;
+  const MeshBatch& batch = pendingTile.pLoadThreadResult->batches[meshIndex];
+  const std::vector<int32_t>& subMeshPrimitives = batch.primitives;
 
-        // Initialize overlay UVs to all use index 0, attachRasterTile will
-        // update the uniforms with the correct UV index.
-        for (uint32_t i = 0; i < currentOverlayCount; ++i) {
-          material.SetFloat(
-              shaderProperty.getOverlayTextureCoordinateIndexID(i),
-              0);
-        }
+  CesiumGltfGameObject& cesiumGameObject = *pendingTile.pCesiumGameObject;
+  std::vector<CesiumPrimitiveInfo>& primitiveInfos =
+      cesiumGameObject.primitiveInfos;
 
-        meshFilter.sharedMesh(unityMesh);
+  UnityEngine::Mesh unityMesh =
+      pendingTile.pLoadThreadResult->meshes[meshIndex];
+  if (unityMesh == nullptr || subMeshPrimitives.empty()) {
+    // This indicates Unity destroyed the mesh already, which really
+    // shouldn't happen.
+    for (int32_t primitiveIndex : subMeshPrimitives) {
+      primitiveInfos[primitiveIndex].meshIndex = -1;
+    }
+    return;
+  }
 
-        if (createPhysicsMeshes &&
-            primitive.mode != MeshPrimitive::Mode::POINTS) {
-          // This should not trigger mesh baking for physics, because the meshes
-          // were already baked in the worker thread.
-          UnityEngine::MeshCollider meshCollider =
-              primitiveGameObject.AddComponent<UnityEngine::MeshCollider>();
-          meshCollider.sharedMesh(unityMesh);
-        }
-        const ExtensionMeshPrimitiveExtFeatureMetadata* pMetadata =
-            primitive.getExtension<ExtensionMeshPrimitiveExtFeatureMetadata>();
-        if (pMetadata) {
-          pMetadataComponent.NativeImplementation().addMetadata(
-              primitiveGameObject.transform().GetInstanceID(),
-              &gltf,
-              &primitive);
-        }
-      });
+  const PrimitiveToRender& first =
+      pendingTile.primitivesToRender[subMeshPrimitives[0]];
 
-  CesiumGltfGameObject* pCesiumGameObject = new CesiumGltfGameObject{
-      std::move(pModelGameObject),
-      std::move(pLoadThreadResult->primitiveInfos)};
+  std::string meshName = subMeshPrimitives.size() == 1
+                             ? "Primitive " + std::to_string(first.indexInMesh)
+                             : "Mesh " + std::to_string(meshIndex);
+  UnityEngine::GameObject primitiveGameObject{System::String(meshName)};
+  primitiveGameObject.hideFlags(renderState.gameObjectHideFlags);
 
-  return pCesiumGameObject;
+  UnityEngine::Transform parentTransform =
+      cesiumGameObject.pGameObject->transform();
+  primitiveGameObject.transform().parent(parentTransform);
+
+  // Primitives are only combined when they share a node transform, so the
+  // first one speaks for the whole mesh.
+  glm::dmat4 modelToEcef =
+      pendingTile.tileTransform * first.transform * batch.positionTransform;
+
+  CesiumForUnity::CesiumGlobeAnchor anchor =
+      primitiveGameObject.AddComponent<CesiumForUnity::CesiumGlobeAnchor>();
+  anchor.detectTransformChanges(false);
+  anchor.adjustOrientationForGlobeWhenMoving(false);
+  anchor.localToGlobeFixedMatrix(
+      UnityTransforms::toUnityMathematics(modelToEcef));
+
+  UnityEngine::MeshFilter meshFilter =
+      primitiveGameObject.AddComponent<UnityEngine::MeshFilter>();
+  UnityEngine::MeshRenderer meshRenderer =
+      primitiveGameObject.AddComponent<UnityEngine::MeshRenderer>();
+
+  // Use one shared material per sub-mesh. Textures and raster overlays are
+  // set per sub-mesh with property blocks, or on the material when the
+  // render pipeline batches without them. Overlays may have been attached to
+  // the tile before this mesh was finalized, so apply them here, too.
+  System::Array1<UnityEngine::Material> materials(
+      static_cast<int32_t>(subMeshPrimitives.size()));
+  for (size_t i = 0; i < subMeshPrimitives.size(); ++i) {
+    const int32_t primitiveIndex = subMeshPrimitives[i];
+    resolveMaterial(
+        renderState,
+        this->_shaderProperty,
+        *pendingTile.pModel,
+        *pendingTile.primitivesToRender[primitiveIndex].pPrimitive,
+        cesiumGameObject.textures,
+        primitiveInfos[primitiveIndex]);
+    materials.Item(
+        static_cast<int32_t>(i),
+        acquirePrimitiveMaterial(
+            renderState,
+            this->_shaderProperty,
+            this->_materialCache,
+            primitiveInfos[primitiveIndex],
+            cesiumGameObject.rasterAttachments));
+  }
+  meshRenderer.sharedMaterials(materials);
+
+  if (renderState.usePropertyBlocks) {
+    for (int32_t primitiveIndex : subMeshPrimitives) {
+      updatePropertyBlock(
+          this->_propertyBlock,
+          meshRenderer,
+          primitiveInfos[primitiveIndex],
+          cesiumGameObject.rasterAttachments,
+          this->_shaderProperty);
+    }
+  }
+
+  meshFilter.sharedMesh(unityMesh);
+
+  if (renderState.createPhysicsMeshes &&
+      first.pPrimitive->mode != MeshPrimitive::Mode::POINTS) {
+    // This should not trigger mesh baking for physics, because the meshes
+    // were already baked in the worker thread.
+    UnityEngine::MeshCollider meshCollider =
+        primitiveGameObject.AddComponent<UnityEngine::MeshCollider>();
+    meshCollider.sharedMesh(unityMesh);
+  }
+
+  // Primitives with metadata are never combined, see planMeshBatches.
+  const ExtensionMeshPrimitiveExtFeatureMetadata* pMetadata =
+      first.pPrimitive
+          ->getExtension<ExtensionMeshPrimitiveExtFeatureMetadata>();
+  if (pMetadata) {
+    pendingTile.metadataComponent.NativeImplementation().addMetadata(
+        primitiveGameObject.transform().GetInstanceID(),
+        pendingTile.pModel,
+        first.pPrimitive);
+  }
+
+  // From here on, the mesh index refers to the child game object that
+  // renders the primitive. Meshes are finalized in order, so a mesh that is
+  // still pending never has an index that collides with a child's.
+  const int32_t childIndex =
+      static_cast<int32_t>(cesiumGameObject.meshRenderers.size());
+  cesiumGameObject.meshRenderers.emplace_back(meshRenderer);
+  for (int32_t primitiveIndex : subMeshPrimitives) {
+    primitiveInfos[primitiveIndex].meshIndex = childIndex;
+  }
 }
 
 namespace {
 
 void freePrimitiveGameObject(
     const DotNet::UnityEngine::GameObject& primitiveGameObject,
-    const DotNet::CesiumForUnity::CesiumMetadata& maybeMetadata) {
+    const DotNet::CesiumForUnity::CesiumMetadata& maybeMetadata,
+    MaterialCache& materialCache) {
   if (maybeMetadata != nullptr) {
     maybeMetadata.NativeImplementation().removeMetadata(
         primitiveGameObject.transform().GetInstanceID());
@@ -1053,18 +2248,13 @@ void freePrimitiveGameObject(
   UnityEngine::MeshRenderer meshRenderer =
       primitiveGameObject.GetComponent<UnityEngine::MeshRenderer>();
   if (meshRenderer != nullptr) {
-    UnityEngine::Material material = meshRenderer.sharedMaterial();
-
-    System::Collections::Generic::List1<int> textureIDs;
-    material.GetTexturePropertyNameIDs(textureIDs);
-    for (int32_t i = 0, len = textureIDs.Count(); i < len; ++i) {
-      int32_t textureID = textureIDs[i];
-      UnityEngine::Texture texture = material.GetTexture(textureID);
-      if (texture != nullptr)
-        UnityLifetime::Destroy(texture);
+    System::Array1<UnityEngine::Material> materials =
+        meshRenderer.sharedMaterials();
+    for (int32_t i = 0, len = materials.Length(); i < len; ++i) {
+      UnityEngine::Material material = materials[i];
+      if (material != nullptr)
+        materialCache.release(material);
     }
-
-    UnityLifetime::Destroy(material);
   }
 
   UnityEngine::MeshFilter meshFilter =
@@ -1096,6 +2286,26 @@ void UnityPrepareRendererResources::free(
     std::unique_ptr<CesiumGltfGameObject> pCesiumGameObject(
         static_cast<CesiumGltfGameObject*>(pMainThreadResult));
 
+    // Destroy the meshes that were not given a game object yet.
+    auto pendingIt = std::find_if(
+        this->_pendingTiles.begin(),
+        this->_pendingTiles.end(),
+        [pCesiumGameObject = pCesiumGameObject.get()](
+            const std::unique_ptr<PendingTile>& pPendingTile) {
+          return pPendingTile->pCesiumGameObject == pCesiumGameObject;
+        });
+    if (pendingIt != this->_pendingTiles.end()) {
+      const PendingTile& pendingTile = **pendingIt;
+      const System::Array1<UnityEngine::Mesh>& meshes =
+          pendingTile.pLoadThreadResult->meshes;
+      for (int32_t i = pendingTile.nextMeshIndex, len = meshes.Length();
+           i < len;
+           ++i) {
+        UnityLifetime::Destroy(meshes[i]);
+      }
+      this->_pendingTiles.erase(pendingIt);
+    }
+
     auto metadataComponent =
         pCesiumGameObject->pGameObject
             ->GetComponentInParent<DotNet::CesiumForUnity::CesiumMetadata>();
@@ -1108,10 +2318,20 @@ void UnityPrepareRendererResources::free(
     for (int32_t i = parentTransform.childCount() - 1; i >= 0; --i) {
       UnityEngine::GameObject primitiveGameObject =
           parentTransform.GetChild(i).gameObject();
-      freePrimitiveGameObject(primitiveGameObject, metadataComponent);
+      freePrimitiveGameObject(
+          primitiveGameObject,
+          metadataComponent,
+          this->_materialCache);
       UnityLifetime::Destroy(primitiveGameObject);
     }
 
+    // The tile's textures may be shared by several primitives, so they are
+    // destroyed here, once each, rather than with the primitives.
+    for (const auto& [textureIndex, texture] : pCesiumGameObject->textures) {
+      if (texture != nullptr)
+        UnityLifetime::Destroy(texture);
+    }
+
     UnityLifetime::Destroy(*pCesiumGameObject->pGameObject);
   }
 }
@@ -1119,14 +2339,22 @@ void UnityPrepareRendererResources::free(
 void* UnityPrepareRendererResources::prepareRasterInLoadThread(
     CesiumGltf::ImageCesium& image,
     const std::any& rendererOptions) {
+  // The raster texture is created in the main thread, but its mips can be
+  // generated and compressed here.
+  ImageProcessing::generateMipMaps(image);
+  if (this->_compressTextures) {
+    ImageProcessing::compressToBC1(image);
+  }
   return nullptr;
 }
 
 void* UnityPrepareRendererResources::prepareRasterInMainThread(
     Cesium3DTilesSelection::RasterOverlayTile& rasterTile,
     void* pLoadThreadResult) {
-  auto pTexture = std::make_unique<UnityEngine::Texture>(
-      TextureLoader::loadTexture(rasterTile.getImage()));
+  // Raster tiles come and go constantly as the camera moves, so their
+  // textures are recycled through the TexturePool rather than destroyed.
+  auto pTexture = std::make_unique<UnityEngine::Texture2D>(
+      TextureLoader::loadPooledTexture(rasterTile.getImage()));
   pTexture->wrapMode(UnityEngine::TextureWrapMode::Clamp);
   pTexture->filterMode(UnityEngine::FilterMode::Trilinear);
   pTexture->anisoLevel(16);
@@ -1138,9 +2366,9 @@ void UnityPrepareRendererResources::freeRaster(
     void* pLoadThreadResult,
     void* pMainThreadResult) noexcept {
   if (pMainThreadResult) {
-    std::unique_ptr<UnityEngine::Texture> pTexture(
-        static_cast<UnityEngine::Texture*>(pMainThreadResult));
-    UnityLifetime::Destroy(*pTexture);
+    std::unique_ptr<UnityEngine::Texture2D> pTexture(
+        static_cast<UnityEngine::Texture2D*>(pMainThreadResult));
+    TexturePool::release(*pTexture);
   }
 }
 
@@ -1160,94 +2388,36 @@ void UnityPrepareRendererResources::attachRasterInMainThread(
 
   CesiumGltfGameObject* pCesiumGameObject =
       static_cast<CesiumGltfGameObject*>(pRenderContent->getRenderResources());
-  UnityEngine::Texture* pTexture =
-      static_cast<UnityEngine::Texture*>(pMainThreadRendererResources);
+  UnityEngine::Texture2D* pTexture =
+      static_cast<UnityEngine::Texture2D*>(pMainThreadRendererResources);
   if (!pCesiumGameObject || !pCesiumGameObject->pGameObject || !pTexture)
     return;
 
-  DotNet::CesiumForUnity::Cesium3DTileset tilesetComponent =
-      this->_tileset.GetComponent<DotNet::CesiumForUnity::Cesium3DTileset>();
-  Tileset* pTileset = tilesetComponent.NativeImplementation().getTileset();
-  if (!pTileset)
-    return;
-
-  uint32_t overlayIndex = 0;
-  bool overlayFound = false;
-  for (const CesiumUtility::IntrusivePointer<RasterOverlay>& pOverlay :
-       pTileset->getOverlays()) {
-    // TODO: Is it safe to compare pointers like this?
-    if (&rasterTile.getOverlay() == pOverlay.get()) {
-      overlayFound = true;
-      break;
-    }
-
-    ++overlayIndex;
-  }
-
-  if (!overlayFound)
+  std::optional<uint32_t> maybeOverlayIndex =
+      this->getOverlayIndex(rasterTile.getOverlay());
+  if (!maybeOverlayIndex)
     return;
 
-  // TODO: Can we count on the order of primitives in the transform chain
-  // to match the order of primitives using gltf->forEachPrimitive??
-  uint32_t primitiveIndex = 0;
-
-  UnityEngine::Transform transform =
-      pCesiumGameObject->pGameObject->transform();
-  for (int32_t i = 0, len = transform.childCount(); i < len; ++i) {
-    UnityEngine::Transform childTransform = transform.GetChild(i);
-    if (childTransform == nullptr)
-      continue;
-
-    UnityEngine::GameObject child = childTransform.gameObject();
-    if (child == nullptr)
-      continue;
-
-    UnityEngine::MeshRenderer meshRenderer =
-        child.GetComponent<UnityEngine::MeshRenderer>();
-    if (meshRenderer == nullptr)
-      continue;
-
-    UnityEngine::Material material = meshRenderer.sharedMaterial();
-    if (material == nullptr)
-      continue;
-
-    const CesiumPrimitiveInfo& primitiveInfo =
-        pCesiumGameObject->primitiveInfos[primitiveIndex++];
-
-    // Note: The overlay texture coordinate index corresponds to the glTF
-    // attribute _CESIUMOVERLAY_<i>. Here we retrieve the Unity texture
-    // coordinate index corresponding to the glTF texture coordinate index for
-    // this primitive.
-    auto texCoordIndexIt =
-        primitiveInfo.rasterOverlayUvIndexMap.find(overlayTextureCoordinateID);
-    if (texCoordIndexIt == primitiveInfo.rasterOverlayUvIndexMap.end()) {
-      // The associated UV coords for this overlay are missing.
-      // TODO: log warning?
-      continue;
-    }
-
-    // Note: The overlay index is NOT the same as the overlay texture coordinate
-    // index. For instance, multiple overlays could point to the same overlay UV
-    // index - multiple overlays can use the _CESIUMOVERLAY_0 attribute for
-    // example. The _CESIUMOVERLAY_<i> attributes correspond to unique
-    // _projections_, not unique overlays.
-    material.SetFloat(
-        _shaderProperty.getOverlayTextureCoordinateIndexID(overlayIndex),
-        static_cast<float>(texCoordIndexIt->second));
-
-    material.SetTexture(
-        _shaderProperty.getOverlayTextureID(overlayIndex),
-        *pTexture);
-
-    UnityEngine::Vector4 translationAndScale{
-        float(translation.x),
-        float(translation.y),
-        float(scale.x),
-        float(scale.y)};
-    material.SetVector(
-        _shaderProperty.getOverlayTranslationAndScaleID(overlayIndex),
-        translationAndScale);
-  }
+  // Remember the attachment so that meshes that are finalized later get the
+  // overlay, too.
+  pCesiumGameObject->rasterAttachments.emplace_back(
+      CesiumRasterOverlayAttachment{
+          &rasterTile,
+          overlayTextureCoordinateID,
+          *maybeOverlayIndex,
+          *pTexture,
+          UnityEngine::Vector4{
+              float(translation.x),
+              float(translation.y),
+              float(scale.x),
+              float(scale.y)}});
+
+  updateRasterOverlays(
+      this->_renderState,
+      this->_propertyBlock,
+      this->_shaderProperty,
+      this->_materialCache,
+      *pCesiumGameObject);
 }
 
 void UnityPrepareRendererResources::detachRasterInMainThread(
@@ -1264,33 +2434,29 @@ void UnityPrepareRendererResources::detachRasterInMainThread(
 
   CesiumGltfGameObject* pCesiumGameObject =
       static_cast<CesiumGltfGameObject*>(pRenderContent->getRenderResources());
-  UnityEngine::Texture* pTexture =
-      static_cast<UnityEngine::Texture*>(pMainThreadRendererResources);
+  UnityEngine::Texture2D* pTexture =
+      static_cast<UnityEngine::Texture2D*>(pMainThreadRendererResources);
   if (!pCesiumGameObject || !pCesiumGameObject->pGameObject || !pTexture)
     return;
 
-  UnityEngine::Transform transform =
-      pCesiumGameObject->pGameObject->transform();
-  for (int32_t i = 0, len = transform.childCount(); i < len; ++i) {
-    UnityEngine::Transform childTransform = transform.GetChild(i);
-    if (childTransform == nullptr)
-      continue;
-
-    UnityEngine::GameObject child = childTransform.gameObject();
-    if (child == nullptr)
-      continue;
-
-    UnityEngine::MeshRenderer meshRenderer =
-        child.GetComponent<UnityEngine::MeshRenderer>();
-    if (meshRenderer == nullptr)
-      continue;
-
-    UnityEngine::Material material = meshRenderer.sharedMaterial();
-    if (material == nullptr)
-      continue;
-
-    material.SetTexture(
-        _shaderProperty.getOverlayTextureID(overlayTextureCoordinateID),
-        UnityEngine::Texture(nullptr));
-  }
+  std::vector<CesiumRasterOverlayAttachment>& attachments =
+      pCesiumGameObject->rasterAttachments;
+  attachments.erase(
+      std::remove_if(
+          attachments.begin(),
+          attachments.end(),
+          [&rasterTile, overlayTextureCoordinateID](
+              const CesiumRasterOverlayAttachment& attachment) {
+            return attachment.pRasterTile == &rasterTile &&
+                   attachment.overlayTextureCoordinateID ==
+                       overlayTextureCoordinateID;
+          }),
+      attachments.end());
+
+  updateRasterOverlays(
+      this->_renderState,
+      this->_propertyBlock,
+      this->_shaderProperty,
+      this->_materialCache,
+      *pCesiumGameObject);
 }
@@ -1,12 +1,43 @@
 #pragma once
 
+#include "MaterialCache.h"
+
 #include <Cesium3DTilesSelection/IPrepareRendererResources.h>
+#include <Cesium3DTilesSelection/ViewState.h>
 #include <CesiumShaderProperties.h>
 
+#include <DotNet/CesiumForUnity/Cesium3DTileset.h>
+#include <DotNet/CesiumForUnity/CesiumNormalFormat.h>
+#include <DotNet/CesiumForUnity/CesiumTexCoordFormat.h>
 #include <DotNet/UnityEngine/GameObject.h>
+#include <DotNet/UnityEngine/HideFlags.h>
+#include <DotNet/UnityEngine/Material.h>
+#include <DotNet/UnityEngine/MaterialPropertyBlock.h>
+#include <DotNet/UnityEngine/MeshRenderer.h>
+#include <DotNet/UnityEngine/Texture.h>
+#include <DotNet/UnityEngine/Vector4.h>
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace Cesium3DTilesSelection {
+class RasterOverlay;
+class Tileset;
+} // namespace Cesium3DTilesSelection
 
 namespace CesiumForUnityNative {
 
+/**
+ * @brief A texture used by a glTF primitive, and the shader property it is
+ * bound to.
+ */
+struct CesiumPrimitiveTexture {
+  int32_t propertyID;
+  ::DotNet::UnityEngine::Texture texture;
+};
+
 /**
  * @brief Information about how a given glTF primitive was converted into
  * Unity MeshData.
@@ -18,6 +49,20 @@ struct CesiumPrimitiveInfo {
    */
   bool containsPoints = false;
 
+  /**
+   * @brief The index of the Unity mesh that this primitive was written into,
+   * or -1 if the primitive could not be converted. Once the tile's game
+   * objects are created, this is the index of the child game object that
+   * renders the mesh.
+   */
+  int32_t meshIndex = -1;
+
+  /**
+   * @brief The index of this primitive's sub-mesh within its Unity mesh. This
+   * is also the index of its material in the renderer's shared materials.
+   */
+  int32_t subMeshIndex = 0;
+
   /**
    * @brief Maps a texture coordinate index i (TEXCOORD_<i>) to the
    * corresponding Unity texture coordinate index.
@@ -29,6 +74,121 @@ struct CesiumPrimitiveInfo {
    * the corresponding Unity texture coordinate index.
    */
   std::unordered_map<uint32_t, uint32_t> rasterOverlayUvIndexMap{};
+
+  /**
+   * @brief The textures of this primitive's material. The textures are owned
+   * by the CesiumGltfGameObject.
+   */
+  std::vector<CesiumPrimitiveTexture> textures{};
+
+  /**
+   * @brief The parameters of this primitive's material other than its
+   * textures and raster overlays.
+   */
+  MaterialKey materialKey{};
+};
+
+/**
+ * @brief The formats in which glTF vertex attributes are written to Unity
+ * meshes.
+ */
+struct CesiumVertexFormat {
+  /**
+   * @brief The format of vertex normals.
+   */
+  ::DotNet::CesiumForUnity::CesiumNormalFormat normalFormat =
+      ::DotNet::CesiumForUnity::CesiumNormalFormat::Float32;
+
+  /**
+   * @brief The format of all texture coordinate sets.
+   */
+  ::DotNet::CesiumForUnity::CesiumTexCoordFormat texCoordFormat =
+      ::DotNet::CesiumForUnity::CesiumTexCoordFormat::Float32;
+
+  /**
+   * @brief Whether positions are quantized to 16-bit integers relative to the
+   * bounding box of their mesh.
+   */
+  bool quantizePositions = false;
+};
+
+/**
+ * @brief The tileset settings that are needed while creating the game
+ * objects of tiles.
+ *
+ * These are read from the Cesium3DTileset once per frame, so that creating a
+ * tile does not have to call into managed code for each primitive.
+ */
+struct CesiumTilesetRenderState {
+  /**
+   * @brief The material that tile materials are instantiated from: the
+   * tileset's opaque material, or the default tileset material.
+   */
+  ::DotNet::UnityEngine::Material material{nullptr};
+  int32_t materialInstanceID = 0;
+
+  /**
+   * @brief The material that tile materials with the KHR_materials_unlit
+   * extension are instantiated from: the tileset's opaque material, or the
+   * default unlit tileset material.
+   */
+  ::DotNet::UnityEngine::Material unlitMaterial{nullptr};
+  int32_t unlitMaterialInstanceID = 0;
+
+  ::DotNet::UnityEngine::HideFlags gameObjectHideFlags =
+      ::DotNet::UnityEngine::HideFlags::DontSave;
+  ::DotNet::UnityEngine::HideFlags meshHideFlags =
+      ::DotNet::UnityEngine::HideFlags::HideAndDontSave;
+
+  bool createPhysicsMeshes = false;
+
+  /**
+   * @brief Whether textures and raster overlays are set per renderer with a
+   * MaterialPropertyBlock, rather than on the material.
+   *
+   * Property blocks let primitives with different textures share a material,
+   * which is what the built-in render pipeline batches on. The SRP Batcher
+   * used by the scriptable render pipelines does not batch renderers with
+   * property blocks at all, so with those pipelines the textures are set on
+   * the material and only primitives with the same textures share one.
+   */
+  bool usePropertyBlocks = true;
+
+  /**
+   * @brief The number of raster overlays of the tileset.
+   */
+  uint32_t overlayCount = 0;
+
+  /**
+   * @brief The index of each raster overlay in the tileset, which selects the
+   * shader properties its textures are bound to.
+   */
+  std::unordered_map<const Cesium3DTilesSelection::RasterOverlay*, uint32_t>
+      overlayIndices{};
+};
+
+/**
+ * @brief A raster overlay tile that is attached to a glTF.
+ */
+struct CesiumRasterOverlayAttachment {
+  /**
+   * @brief The raster overlay tile that provides the texture.
+   */
+  const Cesium3DTilesSelection::RasterOverlayTile* pRasterTile;
+
+  /**
+   * @brief The overlay texture coordinate index i (_CESIUMOVERLAY_<i>) used by
+   * the overlay.
+   */
+  int32_t overlayTextureCoordinateID;
+
+  /**
+   * @brief The index of the overlay in the tileset.
+   */
+  uint32_t overlayIndex;
+
+  ::DotNet::UnityEngine::Texture texture;
+  ::DotNet::UnityEngine::Vector4 translationAndScale;
 };
 
 /**
@@ -40,11 +200,43 @@ struct CesiumGltfGameObject {
    */
   std::unique_ptr<::DotNet::UnityEngine::GameObject> pGameObject{};
 
+  /**
+   * @brief Whether the game object is active. This mirrors the state last set
+   * with SetActive, so that it is only called when the state changes.
+   */
+  bool active = false;
+
+  /**
+   * @brief Whether some meshes of this glTF have not been given game objects
+   * yet. The game object is kept inactive until they all have, so that a
+   * half-built tile is never shown.
+   */
+  bool pending = false;
+
   /**
    * @brief Information about how glTF mesh primitives were translated to Unity
    * meshes.
    */
   std::vector<CesiumPrimitiveInfo> primitiveInfos{};
+
+  /**
+   * @brief The raster overlay tiles that are currently attached to this glTF.
+   */
+  std::vector<CesiumRasterOverlayAttachment> rasterAttachments{};
+
+  /**
+   * @brief The mesh renderers of the finalized meshes of this glTF, indexed
+   * by {@link CesiumPrimitiveInfo::meshIndex}, so that attaching an overlay
+   * does not have to search the game object hierarchy.
+   */
+  std::vector<::DotNet::UnityEngine::MeshRenderer> meshRenderers{};
+
+  /**
+   * @brief The Unity textures created for this glTF, keyed by glTF texture
+   * index. Primitives that use the same glTF texture share one Unity texture,
+   * which is destroyed when the glTF is freed.
+   */
+  std::unordered_map<int32_t, ::DotNet::UnityEngine::Texture> textures{};
 };
 
 class UnityPrepareRendererResources
@@ -52,6 +244,7 @@ class UnityPrepareRendererResources
 public:
   UnityPrepareRendererResources(
       const ::DotNet::UnityEngine::GameObject& tileset);
+  ~UnityPrepareRendererResources();
 
   virtual CesiumAsync::Future<
       Cesium3DTilesSelection::TileLoadResultAndRenderResources>
@@ -97,9 +290,65 @@ public:
       const Cesium3DTilesSelection::RasterOverlayTile& rasterTile,
       void* pMainThreadRendererResources) noexcept override;
 
+  /**
+   * @brief Creates the game objects, materials, and textures of the meshes of
+   * tiles that were prepared in the main thread, one mesh at a time.
+   *
+   * A single tile may take several frames to finalize. Tiles with the largest
+   * screen-space error from any of the given views are finalized first.
+   *
+   * @param viewStates The views used to prioritize tiles.
+   * @param timeLimitMilliseconds The time after which no more meshes are
+   * finalized in this call, or zero for no limit. At least one mesh is always
+   * finalized.
+   */
+  void finalizeTiles(
+      const std::vector<Cesium3DTilesSelection::ViewState>& viewStates,
+      double timeLimitMilliseconds);
+
+  /**
+   * @brief Gets the number of tiles that have been prepared in the main thread
+   * but still have meshes to finalize.
+   */
+  size_t getPendingTileCount() const { return this->_pendingTiles.size(); }
+
+  /**
+   * @brief Reads the tileset settings used to create tile game objects.
+   *
+   * This must be called on the main thread before tiles are loaded or
+   * finalized in a frame.
+   *
+   * @param tilesetComponent The tileset.
+   * @param pTileset The native tileset, or nullptr if it has not been created
+   * yet, in which case the tileset is treated as having no raster overlays.
+   */
+  void updateRenderState(
+      const ::DotNet::CesiumForUnity::Cesium3DTileset& tilesetComponent,
+      const Cesium3DTilesSelection::Tileset* pTileset);
+
 private:
+  struct PendingTile;
+
+  void finalizeMesh(PendingTile& pendingTile);
+
+  /**
+   * @brief Gets the index of a raster overlay in the tileset, or std::nullopt
+   * if the overlay does not belong to the tileset.
+   */
+  std::optional<uint32_t>
+  getOverlayIndex(const Cesium3DTilesSelection::RasterOverlay& overlay);
+
   ::DotNet::UnityEngine::GameObject _tileset;
   CesiumShaderProperties _shaderProperty;
+  bool _combinePrimitives;
+  CesiumVertexFormat _vertexFormat;
+  bool _compressTextures;
+  std::vector<std::unique_ptr<PendingTile>> _pendingTiles;
+  MaterialCache _materialCache;
+  ::DotNet::UnityEngine::MaterialPropertyBlock _propertyBlock;
+  CesiumTilesetRenderState _renderState;
+  ::DotNet::UnityEngine::Material _defaultMaterial;
+  ::DotNet::UnityEngine::Material _defaultUnlitMaterial;
 };
 
 } // namespace CesiumForUnityNative
@@ -1,5 +1,14 @@
 #include "UnityTilesetExternals.h"
 
+#include "CountingCacheDatabase.h"
+#include "DeduplicatingAssetAccessor.h"
+#include "HttpAssetAccessor.h"
+#include "PriorityAssetAccessor.h"
+#include "PriorityTaskProcessor.h"
+#include "StaleWhileRevalidateAssetAccessor.h"
+#include "ThreadPoolTaskProcessor.h"
+#include "TilePack.h"
+#include "TilePackAssetAccessor.h"
 #include "UnityAssetAccessor.h"
 #include "UnityPrepareRendererResources.h"
 #include "UnityTaskProcessor.h"
@@ -8,10 +17,16 @@
 #include <CesiumAsync/CachingAssetAccessor.h>
 #include <CesiumAsync/SqliteCache.h>
 
+#include <DotNet/CesiumForUnity/CesiumAssetAccessorType.h>
 #include <DotNet/CesiumForUnity/CesiumCreditSystem.h>
+#include <DotNet/CesiumForUnity/CesiumRuntimeSettings.h>
+#include <DotNet/CesiumForUnity/CesiumTaskProcessorType.h>
 #include <DotNet/System/String.h>
 #include <DotNet/UnityEngine/Application.h>
+#include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <ctime>
 #include <memory>
 
 #if UNITY_EDITOR
@@ -26,8 +41,14 @@ namespace CesiumForUnityNative {
 
 namespace {
 
-std::shared_ptr<CachingAssetAccessor> pAccessor = nullptr;
-std::shared_ptr<UnityTaskProcessor> pTaskProcessor = nullptr;
+std::shared_ptr<IAssetAccessor> pTilesetAccessor = nullptr;
+std::shared_ptr<DeduplicatingAssetAccessor> pAccessor = nullptr;
+std::shared_ptr<CountingCacheDatabase> pCacheDatabase = nullptr;
+std::shared_ptr<StaleWhileRevalidateAssetAccessor>
+    pStaleWhileRevalidateAccessor = nullptr;
+std::shared_ptr<TilePackAssetAccessor> pTilePackAccessor = nullptr;
+std::shared_ptr<HttpAssetAccessor> pHttpAccessor = nullptr;
+std::shared_ptr<ITaskProcessor> pTaskProcessor = nullptr;
 std::shared_ptr<CreditSystem> pCreditSystem = nullptr;
 #if UNITY_EDITOR
 // If a tileset is loading in the editor, it won't instantiate the
@@ -36,23 +57,115 @@ std::shared_ptr<CreditSystem> pCreditSystem = nullptr;
 std::shared_ptr<CreditSystem> pEditorCreditSystem = nullptr;
 #endif
 
-const std::shared_ptr<CachingAssetAccessor>& getAssetAccessor() {
-  if (!pAccessor) {
-    std::string tempPath =
-        UnityEngine::Application::temporaryCachePath().ToStlString();
-    std::string cacheDBPath = tempPath + "/cesium-request-cache.sqlite";
+const std::shared_ptr<IAssetAccessor>& getAssetAccessor() {
+  if (!pTilesetAccessor) {
+    std::string cacheDBPath =
+        CesiumForUnity::CesiumRuntimeSettings::requestCachePath().ToStlString();
+    if (cacheDBPath.empty()) {
+      std::string tempPath =
+          UnityEngine::Application::temporaryCachePath().ToStlString();
+      cacheDBPath = tempPath + "/cesium-request-cache.sqlite";
+    }
 
-    pAccessor = std::make_shared<CachingAssetAccessor>(
+    const int32_t maximumItems =
+        CesiumForUnity::CesiumRuntimeSettings::requestCacheMaximumItems();
+    const int32_t requestsPerPrune =
+        CesiumForUnity::CesiumRuntimeSettings::requestCacheRequestsPerPrune();
+    auto pSqliteCache = std::make_shared<SqliteCache>(
         spdlog::default_logger(),
-        std::make_shared<UnityAssetAccessor>(),
-        std::make_shared<SqliteCache>(spdlog::default_logger(), cacheDBPath));
+        cacheDBPath,
+        uint64_t(std::max(maximumItems, int32_t(1))));
+    pCacheDatabase = std::make_shared<CountingCacheDatabase>(pSqliteCache);
+
+    auto pUnityAccessor = std::make_shared<UnityAssetAccessor>();
+    std::shared_ptr<IAssetAccessor> pDownloadAccessor = pUnityAccessor;
+    if (CesiumForUnity::CesiumRuntimeSettings::assetAccessorType() ==
+        CesiumForUnity::CesiumAssetAccessorType::NativeHttp) {
+      pHttpAccessor = std::make_shared<HttpAssetAccessor>(
+          pUnityAccessor,
+          pUnityAccessor->getCesiumHeaders(),
+          CesiumForUnity::CesiumRuntimeSettings::
+              nativeHttpMaximumConcurrentRequests(),
+          CesiumForUnity::CesiumRuntimeSettings::
+              nativeHttpMaximumConnectionsPerHost());
+      pDownloadAccessor = pHttpAccessor;
+    }
+
+    std::shared_ptr<TilePackReader> pTilePack = nullptr;
+    std::string tilePackPath =
+        CesiumForUnity::CesiumRuntimeSettings::tilePackPath().ToStlString();
+    if (!tilePackPath.empty()) {
+      pTilePack = TilePackReader::open(tilePackPath);
+      if (!pTilePack) {
+        SPDLOG_LOGGER_WARN(
+            spdlog::default_logger(),
+            "Could not open the tile pack at {}. Assets will be loaded from "
+            "the request cache and the network.",
+            tilePackPath);
+      }
+    }
+
+    std::shared_ptr<IAssetAccessor> pCachingAccessor =
+        std::make_shared<CachingAssetAccessor>(
+            spdlog::default_logger(),
+            pDownloadAccessor,
+            pCacheDatabase,
+            std::max(requestsPerPrune, int32_t(1)));
+    if (CesiumForUnity::CesiumRuntimeSettings::
+            requestCacheStaleWhileRevalidate()) {
+      pStaleWhileRevalidateAccessor =
+          std::make_shared<StaleWhileRevalidateAssetAccessor>(
+              pCachingAccessor,
+              pCacheDatabase,
+              std::time_t(std::max(
+                  CesiumForUnity::CesiumRuntimeSettings::
+                      requestCacheMaximumStaleness(),
+                  int32_t(0))));
+      pCachingAccessor = pStaleWhileRevalidateAccessor;
+    }
+
+    // The tile pack is checked before the request cache, and both are behind
+    // the deduplication, so that concurrent requests for an asset that isn't
+    // cached yet also share a single lookup.
+    pTilePackAccessor =
+        std::make_shared<TilePackAssetAccessor>(pCachingAccessor, pTilePack);
+    pAccessor = std::make_shared<DeduplicatingAssetAccessor>(pTilePackAccessor);
+
+    // Downloads complete outside of any task lane, so with the priority
+    // thread pool, put their continuations back in the lane of the request.
+    pTilesetAccessor = pAccessor;
+    if (CesiumForUnity::CesiumRuntimeSettings::taskProcessorType() ==
+        CesiumForUnity::CesiumTaskProcessorType::PriorityThreadPool) {
+      pTilesetAccessor = std::make_shared<PriorityAssetAccessor>(pAccessor);
+    }
   }
-  return pAccessor;
+  return pTilesetAccessor;
 }
 
-const std::shared_ptr<UnityTaskProcessor>& getTaskProcessor() {
+std::shared_ptr<ThreadPoolTaskProcessor> pThreadPoolTaskProcessor = nullptr;
+std::shared_ptr<PriorityTaskProcessor> pPriorityTaskProcessor = nullptr;
+
+const std::shared_ptr<ITaskProcessor>& getTaskProcessor() {
   if (!pTaskProcessor) {
-    pTaskProcessor = std::make_shared<UnityTaskProcessor>();
+    const CesiumForUnity::CesiumTaskProcessorType type =
+        CesiumForUnity::CesiumRuntimeSettings::taskProcessorType();
+    const int32_t threadCount =
+        CesiumForUnity::CesiumRuntimeSettings::nativeThreadPoolThreadCount();
+    const uint64_t affinityMask = static_cast<uint64_t>(
+        CesiumForUnity::CesiumRuntimeSettings::nativeThreadPoolAffinityMask());
+
+    if (type == CesiumForUnity::CesiumTaskProcessorType::NativeThreadPool) {
+      pThreadPoolTaskProcessor =
+          std::make_shared<ThreadPoolTaskProcessor>(threadCount, affinityMask);
+      pTaskProcessor = pThreadPoolTaskProcessor;
+    } else if (
+        type == CesiumForUnity::CesiumTaskProcessorType::PriorityThreadPool) {
+      pPriorityTaskProcessor =
+          std::make_shared<PriorityTaskProcessor>(threadCount, affinityMask);
+      pTaskProcessor = pPriorityTaskProcessor;
+    } else {
+      pTaskProcessor = std::make_shared<UnityTaskProcessor>();
+    }
   }
   return pTaskProcessor;
 }
@@ -90,6 +203,38 @@ getCreditSystem(const CesiumForUnity::Cesium3DTileset& tileset) {
 
 } // namespace
 
+PriorityTaskProcessor* getPriorityTaskProcessor() {
+  return pPriorityTaskProcessor.get();
+}
+
+DeduplicatingAssetAccessor* getDeduplicatingAssetAccessor() {
+  return pAccessor.get();
+}
+
+CountingCacheDatabase* getCacheDatabase() { return pCacheDatabase.get(); }
+
+StaleWhileRevalidateAssetAccessor* getStaleWhileRevalidateAssetAccessor() {
+  return pStaleWhileRevalidateAccessor.get();
+}
+
+TilePackAssetAccessor& getTilePackAssetAccessor() {
+  getAssetAccessor();
+  return *pTilePackAccessor;
+}
+
+void shutdownTilesetExternals() {
+  // Stop the downloads first, so that the worker threads don't wait for them.
+  if (pHttpAccessor) {
+    pHttpAccessor->shutdown();
+  }
+  if (pThreadPoolTaskProcessor) {
+    pThreadPoolTaskProcessor->shutdown();
+  }
+  if (pPriorityTaskProcessor) {
+    pPriorityTaskProcessor->shutdown();
+  }
+}
+
 Cesium3DTilesSelection::TilesetExternals
 createTilesetExternals(const CesiumForUnity::Cesium3DTileset& tileset) {
   return TilesetExternals{
@@ -14,7 +14,56 @@ class Cesium3DTileset;
 
 namespace CesiumForUnityNative {
 
+class CountingCacheDatabase;
+class DeduplicatingAssetAccessor;
+class PriorityTaskProcessor;
+class StaleWhileRevalidateAssetAccessor;
+class TilePackAssetAccessor;
+
 Cesium3DTilesSelection::TilesetExternals
 createTilesetExternals(const DotNet::CesiumForUnity::Cesium3DTileset& tileset);
 
+/**
+ * @brief Gets the task processor that tilesets use, if it is a
+ * PriorityTaskProcessor, or nullptr otherwise.
+ */
+PriorityTaskProcessor* getPriorityTaskProcessor();
+
+/**
+ * @brief Gets the accessor that collapses concurrent requests for the same
+ * asset, or nullptr if no tileset has been created yet.
+ */
+DeduplicatingAssetAccessor* getDeduplicatingAssetAccessor();
+
+/**
+ * @brief Gets the database that requests are cached in, or nullptr if no
+ * tileset has been created yet.
+ */
+CountingCacheDatabase* getCacheDatabase();
+
+/**
+ * @brief Gets the accessor that serves expired cache entries while they are
+ * revalidated, or nullptr if stale-while-revalidate is disabled or no tileset
+ * has been created yet.
+ */
+StaleWhileRevalidateAssetAccessor* getStaleWhileRevalidateAssetAccessor();
+
+/**
+ * @brief Gets the accessor that serves requests from a tile pack and records
+ * new ones, creating the asset accessors that tilesets use if they don't
+ * exist yet.
+ *
+ * Must be called from the main thread.
+ */
+TilePackAssetAccessor& getTilePackAssetAccessor();
+
+/**
+ * @brief Aborts the downloads in flight and stops the threads that tilesets
+ * download and load on. Work started afterward runs on the thread that
+ * starts it.
+ *
+ * Must be called from the main thread before the application exits.
+ */
+void shutdownTilesetExternals();
+
 }
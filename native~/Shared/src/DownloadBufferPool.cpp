@@ -0,0 +1,110 @@
+#include "DownloadBufferPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+// Buffers larger than this are freed rather than pooled, so that one unusually
+// large download doesn't stay resident.
+constexpr size_t maximumPooledBufferCapacity = 16 * 1024 * 1024;
+constexpr size_t maximumPooledBufferCount = 32;
+
+std::mutex poolMutex;
+// Sorted by ascending capacity.
+std::vector<std::vector<std::byte>> buffers;
+
+std::atomic<int64_t> responseCount = 0;
+std::atomic<int64_t> bytesReceivedCount = 0;
+std::atomic<int64_t> bytesCopiedCount = 0;
+std::atomic<int64_t> reallocationCount = 0;
+
+bool hasSmallerCapacity(
+    const std::vector<std::byte>& buffer,
+    size_t capacity) noexcept {
+  return buffer.capacity() < capacity;
+}
+
+} // namespace
+
+std::vector<std::byte> DownloadBufferPool::acquire(size_t capacity) {
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    auto it = std::lower_bound(
+        buffers.begin(),
+        buffers.end(),
+        capacity,
+        hasSmallerCapacity);
+    if (it != buffers.end()) {
+      std::vector<std::byte> buffer = std::move(*it);
+      buffers.erase(it);
+      return buffer;
+    }
+  }
+
+  std::vector<std::byte> buffer;
+  buffer.reserve(capacity);
+  return buffer;
+}
+
+void DownloadBufferPool::release(std::vector<std::byte>&& buffer) {
+  const size_t capacity = buffer.capacity();
+  if (capacity == 0 || capacity > maximumPooledBufferCapacity) {
+    return;
+  }
+
+  buffer.clear();
+
+  std::lock_guard<std::mutex> lock(poolMutex);
+  if (buffers.size() >= maximumPooledBufferCount) {
+    // Keep the larger buffers, which are the most expensive to reallocate.
+    if (buffers.front().capacity() >= capacity) {
+      return;
+    }
+    buffers.erase(buffers.begin());
+  }
+
+  auto it = std::lower_bound(
+      buffers.begin(),
+      buffers.end(),
+      capacity,
+      hasSmallerCapacity);
+  buffers.insert(it, std::move(buffer));
+}
+
+void DownloadBufferPool::recordResponse(
+    size_t bytesReceived,
+    size_t bytesCopied,
+    size_t reallocations) {
+  ++responseCount;
+  bytesReceivedCount += int64_t(bytesReceived);
+  bytesCopiedCount += int64_t(bytesCopied);
+  reallocationCount += int64_t(reallocations);
+}
+
+int64_t DownloadBufferPool::getResponseCount() { return responseCount; }
+
+int64_t DownloadBufferPool::getBytesReceived() { return bytesReceivedCount; }
+
+int64_t DownloadBufferPool::getBytesCopied() { return bytesCopiedCount; }
+
+int64_t DownloadBufferPool::getReallocationCount() {
+  return reallocationCount;
+}
+
+int32_t DownloadBufferPool::getPooledBufferCount() {
+  std::lock_guard<std::mutex> lock(poolMutex);
+  return int32_t(buffers.size());
+}
+
+void DownloadBufferPool::resetStatistics() {
+  responseCount = 0;
+  bytesReceivedCount = 0;
+  bytesCopiedCount = 0;
+  reallocationCount = 0;
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief A pool of download buffers that are no longer in use.
+ *
+ * Each response body is received into a buffer taken from this pool, sized
+ * from the Content-Length of the response when it is known, and the buffer is
+ * returned to the pool when the response is destroyed. Tile payloads are
+ * mostly of similar sizes, so the large allocations for them are reused
+ * instead of being made and freed for every request.
+ *
+ * The pool also keeps statistics about how many bytes were copied to receive
+ * each response, which includes the copies made when a buffer had to grow.
+ *
+ * All functions may be called from any thread.
+ */
+class DownloadBufferPool {
+public:
+  /**
+   * @brief Takes an empty buffer with at least the given capacity, reusing a
+   * pooled buffer if one is large enough.
+   */
+  static std::vector<std::byte> acquire(size_t capacity);
+
+  /**
+   * @brief Returns a buffer to the pool. Buffers that are very large, or that
+   * arrive when the pool is full, are freed instead.
+   */
+  static void release(std::vector<std::byte>&& buffer);
+
+  /**
+   * @brief Records that a response was received.
+   *
+   * @param bytesReceived The size of the response body.
+   * @param bytesCopied The number of bytes copied to receive it, including
+   * copies made when the buffer grew.
+   * @param reallocations The number of times the buffer grew.
+   */
+  static void recordResponse(
+      size_t bytesReceived,
+      size_t bytesCopied,
+      size_t reallocations);
+
+  static int64_t getResponseCount();
+  static int64_t getBytesReceived();
+  static int64_t getBytesCopied();
+  static int64_t getReallocationCount();
+  static int32_t getPooledBufferCount();
+
+  /**
+   * @brief Resets the response, byte, and reallocation counts to zero.
+   */
+  static void resetStatistics();
+};
+
+} // namespace CesiumForUnityNative
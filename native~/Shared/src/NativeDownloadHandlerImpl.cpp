@@ -1,18 +1,71 @@
 #include "NativeDownloadHandlerImpl.h"
 
+#include "DownloadBufferPool.h"
+
+#include <limits>
+
 using namespace DotNet::CesiumForUnity;
 
 namespace CesiumForUnityNative {
 
 NativeDownloadHandlerImpl::NativeDownloadHandlerImpl(
-    const NativeDownloadHandler& handler) {}
+    const NativeDownloadHandler& handler)
+    : _data(), _responseHeaders(), _bytesCopied(0), _reallocations(0) {}
+
+NativeDownloadHandlerImpl::~NativeDownloadHandlerImpl() {
+  DownloadBufferPool::release(std::move(this->_data));
+}
+
+void NativeDownloadHandlerImpl::ReceiveContentLengthHeaderNative(
+    const NativeDownloadHandler& handler,
+    std::uint64_t contentLength) {
+  if (contentLength >
+          std::uint64_t(std::numeric_limits<std::int32_t>::max()) ||
+      contentLength <= this->_data.capacity()) {
+    return;
+  }
+
+  if (this->_data.empty()) {
+    DownloadBufferPool::release(std::move(this->_data));
+    this->_data = DownloadBufferPool::acquire(size_t(contentLength));
+  } else {
+    this->_bytesCopied += this->_data.size();
+    ++this->_reallocations;
+    this->_data.reserve(size_t(contentLength));
+  }
+}
+
+void NativeDownloadHandlerImpl::ReceiveResponseHeadersNative(
+    const NativeDownloadHandler& handler,
+    void* data,
+    std::int32_t dataLength) {
+  if (data == nullptr || dataLength <= 0) {
+    this->_responseHeaders.clear();
+    return;
+  }
+
+  this->_responseHeaders.assign(
+      static_cast<const char*>(data),
+      size_t(dataLength));
+}
 
 bool NativeDownloadHandlerImpl::ReceiveDataNative(
     const NativeDownloadHandler& handler,
     void* data,
     std::int32_t dataLength) {
+  const size_t length = size_t(dataLength);
+  if (this->_data.capacity() == 0) {
+    // No Content-Length was received, so start from a pooled buffer and let
+    // it grow.
+    this->_data = DownloadBufferPool::acquire(length);
+  } else if (this->_data.size() + length > this->_data.capacity()) {
+    this->_bytesCopied += this->_data.size();
+    ++this->_reallocations;
+  }
+
   std::byte* p = static_cast<std::byte*>(data);
-  this->_data.insert(this->_data.end(), p, p + dataLength);
+  this->_data.insert(this->_data.end(), p, p + length);
+  this->_bytesCopied += length;
   return true;
 }
 
@@ -25,4 +78,18 @@ std::vector<std::byte>& NativeDownloadHandlerImpl::getData() noexcept {
   return this->_data;
 }
 
+std::vector<std::byte> NativeDownloadHandlerImpl::takeData() noexcept {
+  DownloadBufferPool::recordResponse(
+      this->_data.size(),
+      this->_bytesCopied,
+      this->_reallocations);
+  this->_bytesCopied = 0;
+  this->_reallocations = 0;
+  return std::move(this->_data);
+}
+
+std::string NativeDownloadHandlerImpl::takeResponseHeaders() noexcept {
+  return std::move(this->_responseHeaders);
+}
+
 } // namespace CesiumForUnityNative
@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 #include <vector>
 
 namespace DotNet::CesiumForUnity {
@@ -16,6 +17,15 @@ class NativeDownloadHandlerImpl {
 public:
   NativeDownloadHandlerImpl(
       const ::DotNet::CesiumForUnity::NativeDownloadHandler& handler);
+  ~NativeDownloadHandlerImpl();
+
+  void ReceiveContentLengthHeaderNative(
+      const ::DotNet::CesiumForUnity::NativeDownloadHandler& handler,
+      std::uint64_t contentLength);
+  void ReceiveResponseHeadersNative(
+      const ::DotNet::CesiumForUnity::NativeDownloadHandler& handler,
+      void* data,
+      std::int32_t dataLength);
   bool ReceiveDataNative(
       const ::DotNet::CesiumForUnity::NativeDownloadHandler& handler,
       void* data,
@@ -24,8 +34,26 @@ public:
   const std::vector<std::byte>& getData() const noexcept;
   std::vector<std::byte>& getData() noexcept;
 
+  /**
+   * @brief Moves the received data out of this handler and records its
+   * statistics with the {@link DownloadBufferPool}. The buffer should be
+   * returned to the pool with {@link DownloadBufferPool::release} when it is
+   * no longer needed.
+   */
+  std::vector<std::byte> takeData() noexcept;
+
+  /**
+   * @brief Moves the response headers received by
+   * `NativeDownloadHandler.TransferResponseHeaders` out of this handler, as
+   * UTF-8 names and values that are each terminated by a null character.
+   */
+  std::string takeResponseHeaders() noexcept;
+
 private:
   std::vector<std::byte> _data;
+  std::string _responseHeaders;
+  size_t _bytesCopied;
+  size_t _reallocations;
 };
 
 } // namespace CesiumForUnityNative
@@ -0,0 +1,179 @@
+#include "PriorityTaskProcessor.h"
+
+#include "ThreadAffinity.h"
+
+#include <algorithm>
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+// Work started outside of any scope, such as by a raster overlay or by
+// another task processor's caller, is treated as ordinary.
+thread_local TaskPriority currentPriority = TaskPriority::Medium;
+
+} // namespace
+
+PriorityTaskProcessor::Scope::Scope(TaskPriority priority)
+    : _previousPriority(currentPriority) {
+  currentPriority = priority;
+}
+
+PriorityTaskProcessor::Scope::~Scope() {
+  currentPriority = this->_previousPriority;
+}
+
+TaskPriority PriorityTaskProcessor::getCurrentPriority() noexcept {
+  return currentPriority;
+}
+
+PriorityTaskProcessor::DrainScope::DrainScope(
+    PriorityTaskProcessor* pProcessor)
+    : _pProcessor(pProcessor) {
+  if (this->_pProcessor) {
+    this->_pProcessor->setDraining(true);
+  }
+}
+
+PriorityTaskProcessor::DrainScope::~DrainScope() {
+  if (this->_pProcessor) {
+    this->_pProcessor->setDraining(false);
+  }
+}
+
+PriorityTaskProcessor::PriorityTaskProcessor(
+    int32_t threadCount,
+    uint64_t affinityMask)
+    : _threads(),
+      _mutex(),
+      _wakeCondition(),
+      _lanes(),
+      _backloggedTilesetCount(0),
+      _drainCount(0),
+      _stopping(false) {
+  if (threadCount <= 0) {
+    threadCount = std::max(
+        static_cast<int32_t>(std::thread::hardware_concurrency()) - 1,
+        1);
+  }
+
+  this->_threads.reserve(threadCount);
+  for (int32_t i = 0; i < threadCount; ++i) {
+    this->_threads.emplace_back([this]() { this->run(); });
+    setThreadAffinity(this->_threads.back(), affinityMask);
+  }
+}
+
+PriorityTaskProcessor::~PriorityTaskProcessor() { this->shutdown(); }
+
+void PriorityTaskProcessor::shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_stopping = true;
+  }
+  this->_wakeCondition.notify_all();
+
+  for (std::thread& thread : this->_threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+void PriorityTaskProcessor::startTask(std::function<void()> f) {
+  const TaskPriority priority = currentPriority;
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    if (!this->_stopping) {
+      this->_lanes[size_t(priority)].emplace_back(
+          [priority, f = std::move(f)]() {
+            Scope scope(priority);
+            f();
+          });
+      f = nullptr;
+    }
+  }
+
+  if (f) {
+    // Shutting down, so the workers may already be gone.
+    f();
+  } else {
+    this->_wakeCondition.notify_one();
+  }
+}
+
+int32_t PriorityTaskProcessor::getQueuedTaskCount(TaskPriority priority) {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  return static_cast<int32_t>(this->_lanes[size_t(priority)].size());
+}
+
+void PriorityTaskProcessor::setTilesetBacklogged(bool backlogged) {
+  bool resumeLowLane = false;
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    if (backlogged) {
+      ++this->_backloggedTilesetCount;
+    } else if (this->_backloggedTilesetCount > 0) {
+      resumeLowLane = --this->_backloggedTilesetCount == 0;
+    }
+  }
+
+  if (resumeLowLane) {
+    this->_wakeCondition.notify_all();
+  }
+}
+
+void PriorityTaskProcessor::setDraining(bool draining) {
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    if (draining) {
+      ++this->_drainCount;
+    } else if (this->_drainCount > 0) {
+      --this->_drainCount;
+    }
+  }
+
+  if (draining) {
+    this->_wakeCondition.notify_all();
+  }
+}
+
+bool PriorityTaskProcessor::hasRunnableTask() const {
+  const std::deque<std::function<void()>>& lowLane =
+      this->_lanes[size_t(TaskPriority::Low)];
+  return !this->_lanes[size_t(TaskPriority::High)].empty() ||
+         !this->_lanes[size_t(TaskPriority::Medium)].empty() ||
+         (!lowLane.empty() &&
+          (this->_backloggedTilesetCount == 0 || this->_drainCount > 0 ||
+           this->_stopping));
+}
+
+void PriorityTaskProcessor::run() {
+  std::function<void()> task;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(this->_mutex);
+      this->_wakeCondition.wait(lock, [this]() {
+        return this->_stopping || this->hasRunnableTask();
+      });
+
+      if (!this->hasRunnableTask()) {
+        // Stopping, and every queued task has been taken.
+        return;
+      }
+
+      for (std::deque<std::function<void()>>& lane : this->_lanes) {
+        if (!lane.empty()) {
+          task = std::move(lane.front());
+          lane.pop_front();
+          break;
+        }
+      }
+    }
+
+    task();
+    task = nullptr;
+  }
+}
+
+} // namespace CesiumForUnityNative
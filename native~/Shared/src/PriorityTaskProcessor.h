@@ -0,0 +1,138 @@
+#pragma once
+
+#include <CesiumAsync/ITaskProcessor.h>
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief The priority lanes of a {@link PriorityTaskProcessor}, matching the
+ * tile load priority groups reported by cesium-native.
+ */
+enum class TaskPriority : int32_t { High = 0, Medium = 1, Low = 2 };
+
+/**
+ * @brief A task processor that runs tasks on native worker threads from three
+ * priority lanes, always taking from the highest lane that has work.
+ *
+ * `ITaskProcessor::startTask` carries no priority, so a task is put in the
+ * lane of the thread that starts it. Code on the main thread sets that lane
+ * with a {@link Scope}, and each task runs in its own lane, so every
+ * continuation of a task stays in the lane the work started in. Work that
+ * resumes on a thread without a lane, such as when a download completes,
+ * must re-enter the lane it was started in; see
+ * {@link PriorityAssetAccessor}.
+ *
+ * While any tileset reports that loaded tiles are waiting for the main thread
+ * to finalize them, the low lane is paused: producing more speculative work
+ * would only lengthen that backlog. Destroying a tileset waits for all of its
+ * loads, including any continuations in the low lane, so the lane must be
+ * drained with a {@link DrainScope} around it.
+ */
+class PriorityTaskProcessor : public CesiumAsync::ITaskProcessor {
+public:
+  /**
+   * @brief Sets the lane of tasks started on the current thread for the
+   * lifetime of the scope.
+   */
+  class Scope {
+  public:
+    explicit Scope(TaskPriority priority);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    TaskPriority _previousPriority;
+  };
+
+  /**
+   * @brief Gets the lane of tasks started on the current thread.
+   */
+  static TaskPriority getCurrentPriority() noexcept;
+
+  /**
+   * @brief Runs the low lane even while tilesets are backlogged, for the
+   * lifetime of the scope.
+   */
+  class DrainScope {
+  public:
+    /**
+     * @param pProcessor The processor to drain, or nullptr to do nothing.
+     */
+    explicit DrainScope(PriorityTaskProcessor* pProcessor);
+    ~DrainScope();
+
+    DrainScope(const DrainScope&) = delete;
+    DrainScope& operator=(const DrainScope&) = delete;
+
+  private:
+    PriorityTaskProcessor* _pProcessor;
+  };
+
+  /**
+   * @brief Starts the worker threads.
+   *
+   * @param threadCount The number of worker threads, or 0 to use one fewer
+   * than the number of hardware threads, leaving one for the main thread.
+   * @param affinityMask A mask of the logical processors the workers may run
+   * on, where bit i is processor i, or 0 to let them run on any processor.
+   */
+  PriorityTaskProcessor(int32_t threadCount, uint64_t affinityMask);
+
+  /**
+   * @brief Shuts down the pool if {@link shutdown} was not called.
+   */
+  ~PriorityTaskProcessor();
+
+  virtual void startTask(std::function<void()> f) override;
+
+  /**
+   * @brief Stops the worker threads once the queued tasks, including any in
+   * the paused low lane, have run. Tasks started afterward run immediately on
+   * the thread that starts them.
+   *
+   * This must be called before the application exits rather than left to
+   * static destruction, which may run while the native library is unloaded.
+   */
+  void shutdown();
+
+  /**
+   * @brief Gets the number of tasks waiting in a lane.
+   */
+  int32_t getQueuedTaskCount(TaskPriority priority);
+
+  /**
+   * @brief Records that a tileset has, or no longer has, loaded tiles waiting
+   * to be finalized on the main thread. The low lane is paused while any
+   * tileset does.
+   */
+  void setTilesetBacklogged(bool backlogged);
+
+private:
+  static constexpr size_t LANE_COUNT = 3;
+
+  void run();
+  bool hasRunnableTask() const;
+  void setDraining(bool draining);
+
+  std::vector<std::thread> _threads;
+
+  std::mutex _mutex;
+  std::condition_variable _wakeCondition;
+  std::array<std::deque<std::function<void()>>, LANE_COUNT> _lanes;
+  int32_t _backloggedTilesetCount;
+  int32_t _drainCount;
+  bool _stopping;
+};
+
+} // namespace CesiumForUnityNative
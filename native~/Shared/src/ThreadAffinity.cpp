@@ -0,0 +1,39 @@
+#include "ThreadAffinity.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#elif defined(__linux__) || defined(__ANDROID__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace CesiumForUnityNative {
+
+void setThreadAffinity(std::thread& thread, uint64_t affinityMask) {
+  if (affinityMask == 0) {
+    return;
+  }
+
+#if defined(_WIN32)
+  SetThreadAffinityMask(
+      thread.native_handle(),
+      static_cast<DWORD_PTR>(affinityMask));
+#elif defined(__linux__) || defined(__ANDROID__)
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  for (int i = 0; i < 64 && i < CPU_SETSIZE; ++i) {
+    if (affinityMask & (uint64_t(1) << i)) {
+      CPU_SET(i, &cpuSet);
+    }
+  }
+  pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet);
+#else
+  // Apple platforms only offer affinity hints between threads, not a way to
+  // choose processors, so the mask is ignored.
+  (void)thread;
+#endif
+}
+
+} // namespace CesiumForUnityNative
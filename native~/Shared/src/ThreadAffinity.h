@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <thread>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief Restricts a thread to the logical processors in a mask, where bit i
+ * is processor i. A mask of 0 leaves the thread free to run on any
+ * processor.
+ *
+ * This does nothing on platforms that do not support thread affinity, such
+ * as macOS and iOS.
+ */
+void setThreadAffinity(std::thread& thread, uint64_t affinityMask);
+
+} // namespace CesiumForUnityNative
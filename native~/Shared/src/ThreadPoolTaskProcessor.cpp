@@ -0,0 +1,156 @@
+#include "ThreadPoolTaskProcessor.h"
+
+#include "ThreadAffinity.h"
+
+#include <algorithm>
+
+namespace CesiumForUnityNative {
+
+namespace {
+
+// The pool that the current thread is a worker of, and the index of that
+// worker, so tasks started from a worker stay on its own queue.
+thread_local const ThreadPoolTaskProcessor* pCurrentPool = nullptr;
+thread_local size_t currentWorkerIndex = 0;
+
+} // namespace
+
+ThreadPoolTaskProcessor::ThreadPoolTaskProcessor(
+    int32_t threadCount,
+    uint64_t affinityMask)
+    : _workers(),
+      _threads(),
+      _nextWorker(0),
+      _wakeMutex(),
+      _wakeCondition(),
+      _pendingTaskCount(0),
+      _stopping(false) {
+  if (threadCount <= 0) {
+    threadCount = std::max(
+        static_cast<int32_t>(std::thread::hardware_concurrency()) - 1,
+        1);
+  }
+
+  this->_workers.reserve(threadCount);
+  for (int32_t i = 0; i < threadCount; ++i) {
+    this->_workers.emplace_back(std::make_unique<Worker>());
+  }
+
+  this->_threads.reserve(threadCount);
+  for (int32_t i = 0; i < threadCount; ++i) {
+    this->_threads.emplace_back([this, i]() { this->run(size_t(i)); });
+    setThreadAffinity(this->_threads.back(), affinityMask);
+  }
+}
+
+ThreadPoolTaskProcessor::~ThreadPoolTaskProcessor() { this->shutdown(); }
+
+void ThreadPoolTaskProcessor::shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(this->_wakeMutex);
+    this->_stopping = true;
+  }
+  this->_wakeCondition.notify_all();
+
+  for (std::thread& thread : this->_threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+void ThreadPoolTaskProcessor::startTask(std::function<void()> f) {
+  // The task is counted in the same critical section that checks whether the
+  // pool is stopping, so the workers can't exit without running it.
+  bool stopping;
+  {
+    std::lock_guard<std::mutex> lock(this->_wakeMutex);
+    stopping = this->_stopping;
+    if (!stopping) {
+      ++this->_pendingTaskCount;
+    }
+  }
+
+  if (stopping) {
+    f();
+    return;
+  }
+
+  size_t workerIndex;
+  if (pCurrentPool == this) {
+    workerIndex = currentWorkerIndex;
+  } else {
+    workerIndex = this->_nextWorker.fetch_add(1, std::memory_order_relaxed) %
+                  this->_workers.size();
+  }
+
+  Worker& worker = *this->_workers[workerIndex];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.emplace_back(std::move(f));
+  }
+  this->_wakeCondition.notify_one();
+}
+
+void ThreadPoolTaskProcessor::run(size_t workerIndex) {
+  pCurrentPool = this;
+  currentWorkerIndex = workerIndex;
+
+  std::function<void()> task;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(this->_wakeMutex);
+      this->_wakeCondition.wait(lock, [this]() {
+        return this->_pendingTaskCount > 0 || this->_stopping;
+      });
+
+      if (this->_pendingTaskCount == 0) {
+        // Stopping, and every queued task has been taken.
+        return;
+      }
+
+      // Claim a task. It is in some worker's queue, or about to be added to
+      // one. Another worker may also take it first, in which case this one
+      // keeps looking until it finds the one that worker left behind.
+      --this->_pendingTaskCount;
+    }
+
+    while (!this->tryTake(workerIndex, task)) {
+      std::this_thread::yield();
+    }
+
+    task();
+    task = nullptr;
+  }
+}
+
+bool ThreadPoolTaskProcessor::tryTake(
+    size_t workerIndex,
+    std::function<void()>& task) {
+  // Newest task from this worker's own queue first.
+  {
+    Worker& worker = *this->_workers[workerIndex];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+      return true;
+    }
+  }
+
+  // Otherwise steal the oldest task from another worker.
+  const size_t workerCount = this->_workers.size();
+  for (size_t offset = 1; offset < workerCount; ++offset) {
+    Worker& victim = *this->_workers[(workerIndex + offset) % workerCount];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace CesiumForUnityNative
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <CesiumAsync/ITaskProcessor.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CesiumForUnityNative {
+
+/**
+ * @brief A task processor that runs tasks on a fixed set of native worker
+ * threads, without calling into managed code.
+ *
+ * Each worker has its own queue. A task started from a worker goes to the
+ * back of that worker's queue, and the worker takes its newest task first, so
+ * continuations run while their data is still in cache. A worker whose queue
+ * is empty steals the oldest task from another worker. Tasks started from
+ * other threads are spread across the workers in turn.
+ */
+class ThreadPoolTaskProcessor : public CesiumAsync::ITaskProcessor {
+public:
+  /**
+   * @brief Starts the worker threads.
+   *
+   * @param threadCount The number of worker threads, or 0 to use one fewer
+   * than the number of hardware threads, leaving one for the main thread.
+   * @param affinityMask A mask of the logical processors the workers may run
+   * on, where bit i is processor i, or 0 to let them run on any processor.
+   * The mask is ignored on platforms that do not support thread affinity.
+   */
+  ThreadPoolTaskProcessor(int32_t threadCount, uint64_t affinityMask);
+
+  /**
+   * @brief Shuts down the pool if {@link shutdown} was not called.
+   */
+  ~ThreadPoolTaskProcessor();
+
+  virtual void startTask(std::function<void()> f) override;
+
+  /**
+   * @brief Stops the worker threads once the queued tasks have run. Tasks
+   * started afterward run immediately on the thread that starts them.
+   *
+   * This must be called before the application exits rather than left to
+   * static destruction, which may run while the native library is unloaded.
+   */
+  void shutdown();
+
+private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void run(size_t workerIndex);
+  bool tryTake(size_t workerIndex, std::function<void()>& task);
+
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::vector<std::thread> _threads;
+  std::atomic<size_t> _nextWorker;
+
+  // Idle workers wait here until a task is started or the pool stops.
+  std::mutex _wakeMutex;
+  std::condition_variable _wakeCondition;
+  size_t _pendingTaskCount;
+  bool _stopping;
+};
+
+} // namespace CesiumForUnityNative
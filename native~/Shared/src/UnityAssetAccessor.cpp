@@ -1,6 +1,7 @@
 #include "UnityAssetAccessor.h"
 
 #include "Cesium.h"
+#include "DownloadBufferPool.h"
 
 #include <CesiumAsync/IAssetResponse.h>
 #include <CesiumUtility/ScopeGuard.h>
@@ -8,9 +9,6 @@
 #include <DotNet/CesiumForUnity/Helpers.h>
 #include <DotNet/CesiumForUnity/NativeDownloadHandler.h>
 #include <DotNet/System/Action1.h>
-#include <DotNet/System/Collections/Generic/Dictionary2.h>
-#include <DotNet/System/Collections/Generic/Enumerator0.h>
-#include <DotNet/System/Collections/Generic/KeyValuePair2.h>
 #include <DotNet/System/Environment.h>
 #include <DotNet/System/OperatingSystem.h>
 #include <DotNet/System/String.h>
@@ -27,6 +25,9 @@
 #include <DotNet/UnityEngine/Networking/UploadHandlerRaw.h>
 
 #include <algorithm>
+#include <cctype>
+#include <mutex>
+#include <string_view>
 
 using namespace CesiumAsync;
 using namespace CesiumUtility;
@@ -34,36 +35,93 @@ using namespace DotNet;
 
 namespace {
 
+bool equalsIgnoringCase(std::string_view lhs, std::string_view rhs) noexcept {
+  return lhs.size() == rhs.size() &&
+         std::equal(
+             lhs.begin(),
+             lhs.end(),
+             rhs.begin(),
+             [](unsigned char a, unsigned char b) {
+               return std::tolower(a) == std::tolower(b);
+             });
+}
+
+/**
+ * Calls `callback` with each name and value in headers serialized by
+ * `NativeDownloadHandler.TransferResponseHeaders`, until it returns false.
+ */
+template <typename Callback>
+void forEachRawHeader(const std::string& rawHeaders, Callback&& callback) {
+  size_t nameStart = 0;
+  while (nameStart < rawHeaders.size()) {
+    const size_t nameEnd = rawHeaders.find('\0', nameStart);
+    if (nameEnd == std::string::npos) {
+      return;
+    }
+
+    const size_t valueStart = nameEnd + 1;
+    size_t valueEnd = rawHeaders.find('\0', valueStart);
+    if (valueEnd == std::string::npos) {
+      valueEnd = rawHeaders.size();
+    }
+
+    std::string_view name(rawHeaders.data() + nameStart, nameEnd - nameStart);
+    std::string_view value(
+        rawHeaders.data() + valueStart,
+        valueEnd - valueStart);
+    if (!callback(name, value)) {
+      return;
+    }
+
+    nameStart = valueEnd + 1;
+  }
+}
+
 class UnityAssetResponse : public IAssetResponse {
 public:
   UnityAssetResponse(
       const UnityEngine::Networking::UnityWebRequest& request,
       const DotNet::CesiumForUnity::NativeDownloadHandler& handler)
       : _statusCode(uint16_t(request.responseCode())),
-        _contentType(),
-        _data(std::move(handler.NativeImplementation().getData())) {
-    System::Collections::Generic::Dictionary2<System::String, System::String>
-        responseHeaders = request.GetResponseHeaders();
-    if (responseHeaders != nullptr) {
-      System::Collections::Generic::Enumerator0 enumerator =
-          responseHeaders.GetEnumerator();
-      while (enumerator.MoveNext()) {
-        this->_headers.emplace(
-            enumerator.Current().Key().ToStlString(),
-            enumerator.Current().Value().ToStlString());
-      }
-      auto find = this->_headers.find("content-type");
-      if (find != this->_headers.end()) {
-        this->_contentType = find->second;
-      }
-    }
+        _rawHeaders(),
+        _headersParsed(),
+        _headers(),
+        _data(handler.NativeImplementation().takeData()) {
+    // Transfer all of the headers in a single call. They're parsed later, and
+    // only if they're needed, most likely in a worker thread.
+    handler.TransferResponseHeaders(request);
+    this->_rawHeaders = handler.NativeImplementation().takeResponseHeaders();
   }
 
+  ~UnityAssetResponse() { DownloadBufferPool::release(std::move(this->_data)); }
+
   virtual uint16_t statusCode() const override { return _statusCode; }
 
-  virtual std::string contentType() const override { return _contentType; }
+  virtual std::string contentType() const override {
+    std::string result;
+    forEachRawHeader(
+        this->_rawHeaders,
+        [&result](std::string_view name, std::string_view value) {
+          if (equalsIgnoringCase(name, "content-type")) {
+            result = value;
+            return false;
+          }
+          return true;
+        });
+    return result;
+  }
 
-  virtual const HttpHeaders& headers() const override { return _headers; }
+  virtual const HttpHeaders& headers() const override {
+    std::call_once(this->_headersParsed, [this]() {
+      forEachRawHeader(
+          this->_rawHeaders,
+          [this](std::string_view name, std::string_view value) {
+            this->_headers.emplace(name, value);
+            return true;
+          });
+    });
+    return this->_headers;
+  }
 
   virtual gsl::span<const std::byte> data() const override {
     return this->_data;
@@ -71,8 +129,9 @@ public:
 
 private:
   uint16_t _statusCode;
-  std::string _contentType;
-  HttpHeaders _headers;
+  std::string _rawHeaders;
+  mutable std::once_flag _headersParsed;
+  mutable HttpHeaders _headers;
   std::vector<std::byte> _data;
 };
 
@@ -130,6 +189,13 @@ UnityAssetAccessor::UnityAssetAccessor()
           CesiumForUnityNative::Cesium::version + " " +
           CesiumForUnityNative::Cesium::commit) {}
 
+std::vector<IAssetAccessor::THeader>
+UnityAssetAccessor::getCesiumHeaders() const {
+  return {
+      {"X-Cesium-Platform", this->_cesiumPlatformHeader},
+      {"X-Cesium-Version", this->_cesiumVersionHeader}};
+}
+
 CesiumAsync::Future<std::shared_ptr<CesiumAsync::IAssetRequest>>
 UnityAssetAccessor::get(
     const CesiumAsync::AsyncSystem& asyncSystem,
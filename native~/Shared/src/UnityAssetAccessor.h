@@ -23,6 +23,12 @@ public:
 
   virtual void tick() noexcept override;
 
+  /**
+   * @brief Gets the X-Cesium-Platform and X-Cesium-Version headers that are
+   * added to every request, so that other accessors can send them too.
+   */
+  std::vector<THeader> getCesiumHeaders() const;
+
 private:
   const std::string _cesiumPlatformHeader;
   const std::string _cesiumVersionHeader;
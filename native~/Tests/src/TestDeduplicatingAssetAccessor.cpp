@@ -0,0 +1,37 @@
+#include "DeduplicatingAssetAccessor.h"
+
+#include <catch2/catch.hpp>
+
+using namespace CesiumAsync;
+using namespace CesiumForUnityNative;
+
+TEST_CASE("createDeduplicationKey") {
+  const std::string url = "https://example.com/tiles/0.b3dm";
+
+  SECTION("is the same for the same URL and headers") {
+    CHECK(
+        createDeduplicationKey(url, {{"Accept", "*/*"}}) ==
+        createDeduplicationKey(url, {{"Accept", "*/*"}}));
+  }
+
+  SECTION("differs for different URLs or headers") {
+    CHECK(
+        createDeduplicationKey(url, {}) !=
+        createDeduplicationKey(url + "?v=1", {}));
+    CHECK(
+        createDeduplicationKey(url, {}) !=
+        createDeduplicationKey(url, {{"Accept", "*/*"}}));
+    CHECK(
+        createDeduplicationKey(url, {{"Accept", "*/*"}}) !=
+        createDeduplicationKey(url, {{"Accept", "application/json"}}));
+  }
+
+  SECTION("keeps the URL and headers from running into each other") {
+    CHECK(
+        createDeduplicationKey("https://example.com/ab", {}) !=
+        createDeduplicationKey("https://example.com/a", {{"b", ""}}));
+    CHECK(
+        createDeduplicationKey(url, {{"ab", "c"}}) !=
+        createDeduplicationKey(url, {{"a", "bc"}}));
+  }
+}
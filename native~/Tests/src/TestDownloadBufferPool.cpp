@@ -0,0 +1,58 @@
+#include "DownloadBufferPool.h"
+
+#include <catch2/catch.hpp>
+
+using namespace CesiumForUnityNative;
+
+TEST_CASE("DownloadBufferPool reuses released buffers") {
+  const int32_t initialCount = DownloadBufferPool::getPooledBufferCount();
+
+  std::vector<std::byte> buffer;
+  buffer.resize(1000);
+  const std::byte* pData = buffer.data();
+  DownloadBufferPool::release(std::move(buffer));
+  CHECK(DownloadBufferPool::getPooledBufferCount() == initialCount + 1);
+
+  std::vector<std::byte> reused = DownloadBufferPool::acquire(1000);
+  CHECK(reused.data() == pData);
+  CHECK(reused.empty());
+  CHECK(reused.capacity() >= 1000);
+  CHECK(DownloadBufferPool::getPooledBufferCount() == initialCount);
+}
+
+TEST_CASE("DownloadBufferPool allocates when no buffer is large enough") {
+  std::vector<std::byte> small;
+  small.reserve(16);
+  DownloadBufferPool::release(std::move(small));
+  const int32_t pooledCount = DownloadBufferPool::getPooledBufferCount();
+
+  std::vector<std::byte> buffer = DownloadBufferPool::acquire(4096);
+  CHECK(buffer.capacity() >= 4096);
+  CHECK(DownloadBufferPool::getPooledBufferCount() == pooledCount);
+}
+
+TEST_CASE("DownloadBufferPool doesn't pool empty or very large buffers") {
+  const int32_t initialCount = DownloadBufferPool::getPooledBufferCount();
+
+  DownloadBufferPool::release(std::vector<std::byte>());
+  std::vector<std::byte> large;
+  large.reserve(64 * 1024 * 1024);
+  DownloadBufferPool::release(std::move(large));
+
+  CHECK(DownloadBufferPool::getPooledBufferCount() == initialCount);
+}
+
+TEST_CASE("DownloadBufferPool records response statistics") {
+  DownloadBufferPool::resetStatistics();
+  DownloadBufferPool::recordResponse(100, 150, 1);
+  DownloadBufferPool::recordResponse(200, 200, 0);
+
+  CHECK(DownloadBufferPool::getResponseCount() == 2);
+  CHECK(DownloadBufferPool::getBytesReceived() == 300);
+  CHECK(DownloadBufferPool::getBytesCopied() == 350);
+  CHECK(DownloadBufferPool::getReallocationCount() == 1);
+
+  DownloadBufferPool::resetStatistics();
+  CHECK(DownloadBufferPool::getResponseCount() == 0);
+  CHECK(DownloadBufferPool::getBytesReceived() == 0);
+}
@@ -0,0 +1,173 @@
+#include "ImageProcessing.h"
+
+#include <CesiumGltf/ImageCesium.h>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace CesiumForUnityNative;
+using namespace CesiumGltf;
+
+namespace {
+
+ImageCesium createImage(
+    int32_t width,
+    int32_t height,
+    const std::vector<std::uint8_t>& pixels) {
+  ImageCesium image;
+  image.width = width;
+  image.height = height;
+  image.channels = 4;
+  image.bytesPerChannel = 1;
+  image.pixelData.resize(pixels.size());
+  for (size_t i = 0; i < pixels.size(); ++i) {
+    image.pixelData[i] = std::byte(pixels[i]);
+  }
+  return image;
+}
+
+ImageCesium createSolidImage(
+    int32_t width,
+    int32_t height,
+    std::uint8_t r,
+    std::uint8_t g,
+    std::uint8_t b,
+    std::uint8_t a) {
+  std::vector<std::uint8_t> pixels;
+  for (int32_t i = 0; i < width * height; ++i) {
+    pixels.insert(pixels.end(), {r, g, b, a});
+  }
+  return createImage(width, height, pixels);
+}
+
+std::uint8_t getByte(const ImageCesium& image, size_t offset) {
+  return std::uint8_t(image.pixelData[offset]);
+}
+
+} // namespace
+
+TEST_CASE("ImageProcessing::generateMipMaps") {
+  SECTION("appends every level down to 1x1") {
+    ImageCesium image = createSolidImage(4, 2, 10, 20, 30, 255);
+    REQUIRE(ImageProcessing::generateMipMaps(image));
+
+    REQUIRE(image.mipPositions.size() == 3);
+    CHECK(image.mipPositions[0].byteOffset == 0);
+    CHECK(image.mipPositions[0].byteSize == 32);
+    CHECK(image.mipPositions[1].byteOffset == 32);
+    CHECK(image.mipPositions[1].byteSize == 8);
+    CHECK(image.mipPositions[2].byteOffset == 40);
+    CHECK(image.mipPositions[2].byteSize == 4);
+    CHECK(image.pixelData.size() == 44);
+
+    CHECK(getByte(image, 40) == 10);
+    CHECK(getByte(image, 41) == 20);
+    CHECK(getByte(image, 42) == 30);
+    CHECK(getByte(image, 43) == 255);
+  }
+
+  SECTION("averages each 2x2 block") {
+    ImageCesium image = createImage(
+        2,
+        2,
+        {0, 0, 0, 0, 100, 100, 100, 100, 200, 200, 200, 200, 40, 40, 40, 40});
+    REQUIRE(ImageProcessing::generateMipMaps(image));
+
+    REQUIRE(image.mipPositions.size() == 2);
+    for (size_t c = 0; c < 4; ++c) {
+      CHECK(getByte(image, 16 + c) == 85);
+    }
+  }
+
+  SECTION("skips images that already have mips or aren't RGBA8") {
+    ImageCesium image = createSolidImage(2, 2, 0, 0, 0, 255);
+    REQUIRE(ImageProcessing::generateMipMaps(image));
+    CHECK(!ImageProcessing::generateMipMaps(image));
+
+    ImageCesium rgb = createSolidImage(2, 2, 0, 0, 0, 255);
+    rgb.channels = 3;
+    CHECK(!ImageProcessing::generateMipMaps(rgb));
+
+    ImageCesium compressed = createSolidImage(4, 4, 0, 0, 0, 255);
+    REQUIRE(ImageProcessing::compressToBC1(compressed));
+    CHECK(!ImageProcessing::generateMipMaps(compressed));
+  }
+}
+
+TEST_CASE("ImageProcessing::compressToBC1") {
+  SECTION("encodes a solid color as a single endpoint") {
+    ImageCesium image = createSolidImage(4, 4, 255, 0, 0, 255);
+    REQUIRE(ImageProcessing::compressToBC1(image));
+
+    CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::BC1_RGB);
+    REQUIRE(image.pixelData.size() == 8);
+    REQUIRE(image.mipPositions.size() == 1);
+    CHECK(image.mipPositions[0].byteSize == 8);
+
+    // Pure red is 0xF800 in RGB565.
+    CHECK(getByte(image, 0) == 0x00);
+    CHECK(getByte(image, 1) == 0xF8);
+    CHECK(getByte(image, 2) == 0x00);
+    CHECK(getByte(image, 3) == 0xF8);
+    for (size_t i = 4; i < 8; ++i) {
+      CHECK(getByte(image, i) == 0);
+    }
+  }
+
+  SECTION("selects the opaque mode and the closest endpoint") {
+    std::vector<std::uint8_t> pixels;
+    for (int32_t i = 0; i < 16; ++i) {
+      const std::uint8_t value = i < 8 ? 255 : 0;
+      pixels.insert(pixels.end(), {value, value, value, 255});
+    }
+    ImageCesium image = createImage(4, 4, pixels);
+    REQUIRE(ImageProcessing::compressToBC1(image));
+
+    const uint16_t color0 =
+        uint16_t(getByte(image, 0) | getByte(image, 1) << 8);
+    const uint16_t color1 =
+        uint16_t(getByte(image, 2) | getByte(image, 3) << 8);
+    CHECK(color0 > color1);
+
+    // The top two rows are white, which is closest to color0, and the bottom
+    // two are black, which is closest to color1.
+    CHECK(getByte(image, 4) == 0x00);
+    CHECK(getByte(image, 5) == 0x00);
+    CHECK(getByte(image, 6) == 0x55);
+    CHECK(getByte(image, 7) == 0x55);
+  }
+
+  SECTION("compresses every mip level") {
+    ImageCesium image = createSolidImage(8, 8, 0, 255, 0, 255);
+    REQUIRE(ImageProcessing::generateMipMaps(image));
+    REQUIRE(ImageProcessing::compressToBC1(image));
+
+    // 8x8 is four blocks, and each smaller level is one.
+    REQUIRE(image.mipPositions.size() == 4);
+    CHECK(image.mipPositions[0].byteSize == 32);
+    CHECK(image.mipPositions[1].byteOffset == 32);
+    CHECK(image.mipPositions[1].byteSize == 8);
+    CHECK(image.mipPositions[3].byteOffset == 48);
+    CHECK(image.pixelData.size() == 56);
+  }
+
+  SECTION("skips images that aren't a whole number of blocks") {
+    ImageCesium wide = createSolidImage(6, 4, 255, 255, 255, 255);
+    CHECK(!ImageProcessing::compressToBC1(wide));
+    CHECK(wide.compressedPixelFormat == GpuCompressedPixelFormat::NONE);
+    CHECK(wide.pixelData.size() == 96);
+
+    ImageCesium odd = createSolidImage(3, 5, 255, 255, 255, 255);
+    CHECK(!ImageProcessing::compressToBC1(odd));
+    CHECK(odd.compressedPixelFormat == GpuCompressedPixelFormat::NONE);
+  }
+
+  SECTION("skips images with alpha") {
+    ImageCesium image = createSolidImage(4, 4, 255, 255, 255, 128);
+    CHECK(!ImageProcessing::compressToBC1(image));
+    CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::NONE);
+    CHECK(image.pixelData.size() == 64);
+  }
+}
@@ -0,0 +1,148 @@
+#include "TilePack.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace CesiumForUnityNative;
+
+namespace {
+
+std::string getTemporaryPath(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+std::string toString(const TilePackEntry& entry) {
+  return std::string(
+      reinterpret_cast<const char*>(entry.pData),
+      entry.dataSize);
+}
+
+} // namespace
+
+TEST_CASE("createTilePackKey") {
+  SECTION("leaves URLs without a query unchanged") {
+    CHECK(
+        createTilePackKey("https://example.com/tiles/0.b3dm") ==
+        "https://example.com/tiles/0.b3dm");
+  }
+
+  SECTION("removes access tokens and keeps other parameters") {
+    CHECK(
+        createTilePackKey("https://example.com/a?access_token=abc&v=1") ==
+        "https://example.com/a?v=1");
+    CHECK(
+        createTilePackKey("https://example.com/a?v=1&access_token=abc") ==
+        "https://example.com/a?v=1");
+    CHECK(
+        createTilePackKey("https://example.com/a?v=1&access_token=abc&x=2") ==
+        "https://example.com/a?v=1&x=2");
+  }
+
+  SECTION("removes the query if it only has an access token") {
+    CHECK(
+        createTilePackKey("https://example.com/a?access_token=abc") ==
+        "https://example.com/a");
+  }
+
+  SECTION("removes the fragment after a query") {
+    CHECK(
+        createTilePackKey("https://example.com/a?v=1#top") ==
+        "https://example.com/a?v=1");
+  }
+}
+
+TEST_CASE("TilePackWriter and TilePackReader round-trip entries") {
+  const std::string path = getTemporaryPath("CesiumTilePackTest.pack");
+
+  std::unique_ptr<TilePackWriter> pWriter = TilePackWriter::create(path);
+  REQUIRE(pWriter);
+
+  const std::string tile = "tile content";
+  const std::string layer = "{\"tiles\":[]}";
+  CHECK(pWriter->add(
+      "https://example.com/b/0.b3dm",
+      200,
+      "application/octet-stream",
+      reinterpret_cast<const std::byte*>(tile.data()),
+      tile.size()));
+  CHECK(pWriter->add(
+      "https://example.com/a/layer.json",
+      200,
+      "application/json",
+      reinterpret_cast<const std::byte*>(layer.data()),
+      layer.size()));
+  CHECK(pWriter->add("https://example.com/missing", 404, "", nullptr, 0));
+
+  // Keys can only be added once.
+  CHECK(!pWriter->add(
+      "https://example.com/b/0.b3dm",
+      200,
+      "",
+      reinterpret_cast<const std::byte*>(tile.data()),
+      tile.size()));
+
+  CHECK(pWriter->getEntryCount() == 3);
+  REQUIRE(pWriter->finish());
+  pWriter.reset();
+
+  std::shared_ptr<TilePackReader> pReader = TilePackReader::open(path);
+  REQUIRE(pReader);
+  CHECK(pReader->getPath() == path);
+  CHECK(pReader->getEntryCount() == 3);
+
+  std::optional<TilePackEntry> maybeTile =
+      pReader->find("https://example.com/b/0.b3dm");
+  REQUIRE(maybeTile);
+  CHECK(maybeTile->statusCode == 200);
+  CHECK(maybeTile->contentType == "application/octet-stream");
+  CHECK(toString(*maybeTile) == tile);
+
+  std::optional<TilePackEntry> maybeLayer =
+      pReader->find("https://example.com/a/layer.json");
+  REQUIRE(maybeLayer);
+  CHECK(maybeLayer->contentType == "application/json");
+  CHECK(toString(*maybeLayer) == layer);
+
+  std::optional<TilePackEntry> maybeMissing =
+      pReader->find("https://example.com/missing");
+  REQUIRE(maybeMissing);
+  CHECK(maybeMissing->statusCode == 404);
+  CHECK(maybeMissing->dataSize == 0);
+
+  CHECK(!pReader->find("https://example.com/c/0.b3dm"));
+
+  pReader.reset();
+  std::remove(path.c_str());
+}
+
+TEST_CASE("TilePackReader rejects files that aren't tile packs") {
+  const std::string path = getTemporaryPath("CesiumTilePackTest.invalid");
+  {
+    std::ofstream stream(path, std::ios::binary);
+    const std::string content(64, 'x');
+    stream.write(content.data(), std::streamsize(content.size()));
+  }
+
+  CHECK(!TilePackReader::open(path));
+  CHECK(!TilePackReader::open(getTemporaryPath("CesiumTilePackTest.none")));
+
+  std::remove(path.c_str());
+}
+
+TEST_CASE("TilePackWriter discards unfinished packs") {
+  const std::string path = getTemporaryPath("CesiumTilePackTest.unfinished");
+  std::remove(path.c_str());
+
+  std::unique_ptr<TilePackWriter> pWriter = TilePackWriter::create(path);
+  REQUIRE(pWriter);
+  CHECK(pWriter->add("key", 200, "", nullptr, 0));
+  pWriter.reset();
+
+  CHECK(!std::filesystem::exists(path));
+  CHECK(!std::filesystem::exists(path + ".tmp"));
+}